@@ -0,0 +1,82 @@
+#pragma once
+#include "Tree.hpp"
+#include <algorithm>
+#include <vector>
+
+/**
+*   Write-Buffered Unbalanced Binary Tree
+*    Insert() and Delete() append messages to a buffer held above the root instead of
+*    descending at once. When Capacity messages accumulate, or before any read, the
+*    buffer is sorted by key (preserving the order of messages on equal keys) and pushed
+*    down the tree in one pass, visiting each node at most once per batch; keys that reach
+*    an empty link are built there median-first. Sorted or clustered input thus lands as
+*    a balanced subtree rather than the chain an unbalanced tree grows from ascending
+*    insertions. Reads always observe every buffered update.
+*/
+template <typename K, class I, std::size_t Capacity = 1024>
+class BufferedTree {
+public:
+    using Node = typename Tree<K, I>::Node;
+
+    BufferedTree() : tree{}, buffer{} { buffer.reserve(Capacity); }
+
+    /**
+    * Modifiers
+    *  Delete(K) removes one node with the given key, if any, once the buffer is applied.
+    */
+    void Insert(K k, I&& i);
+    void Delete(K k);
+    void Delete(Node** n) { Flush(); tree.Delete(n); }
+    void Flush();
+
+    /**
+    * Accessors
+    *  Apply pending messages first; return nullptr if the requested item does not exist
+    *  or if the tree is empty.
+    */
+    Node* operator[](K k) { return Search(k); }
+
+    Node* Search(K k) { Flush(); return tree.Search(k); }
+    Node* Minimum() { Flush(); return tree.Minimum(); }
+    Node* Maximum() { Flush(); return tree.Maximum(); }
+    Node* Predecessor(Node* n) { Flush(); return tree.Predecessor(n); }
+    Node* Successor(Node* n) { Flush(); return tree.Successor(n); }
+    Node* LowerBound(K k) { Flush(); return tree.LowerBound(k); }
+
+    std::size_t Pending() const { return buffer.size(); }
+    std::size_t Height() { Flush(); return tree.Height(); }
+    std::vector<std::pair<K, I>> Walk() { Flush(); return tree.Walk(); }
+
+private:
+    using Message = typename Tree<K, I>::Update;
+
+    Tree<K, I> tree;
+    std::vector<Message> buffer;
+};
+
+template <typename K, class I, std::size_t Capacity>
+void BufferedTree<K, I, Capacity>::Insert(K key, I&& item) {
+    buffer.push_back(Message{ key, true, std::forward<I>(item) });
+    if (buffer.size() >= Capacity) {
+        Flush();
+    }
+}
+
+template <typename K, class I, std::size_t Capacity>
+void BufferedTree<K, I, Capacity>::Delete(K key) {
+    buffer.push_back(Message{ key, false, I{} });
+    if (buffer.size() >= Capacity) {
+        Flush();
+    }
+}
+
+template <typename K, class I, std::size_t Capacity>
+void BufferedTree<K, I, Capacity>::Flush() {
+    if (buffer.empty()) {
+        return;
+    }
+    std::stable_sort(buffer.begin(), buffer.end(),
+        [](const Message& a, const Message& b) { return a.key < b.key; });
+    tree.Apply(buffer.data(), buffer.size());
+    buffer.clear();
+}
@@ -0,0 +1,257 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+/**
+*   Compact Unbalanced Binary Tree
+*    Stores nodes in a chunked pool and links them by Index rather than by pointer.
+*    Nodes carry no parent link and no vtable: Predecessor(), Successor() and Delete()
+*    descend from the root instead of walking up. With the default 32-bit Index a
+*    node's links cost 8 bytes, against 32 for Tree::Node, and the tree holds up to
+*    2^32 - 1 nodes. Node addresses are stable until the node is deleted.
+*/
+template <typename K, class I, typename Index = std::uint32_t>
+class CompactTree {
+public:
+    struct Node {
+        K key;
+        I item;
+        Node() : key{}, item{}, left{ Nil }, right{ Nil } {}
+    private:
+        Index left;
+        Index right;
+        friend class CompactTree;
+    };
+
+    CompactTree() : chunks{}, root{ Nil }, available{ Nil }, used{} {};
+    CompactTree(CompactTree&& t) noexcept;
+    CompactTree& operator=(CompactTree&& t) noexcept;
+
+    /**
+    * Modifiers
+    */
+    void Insert(K k, I&& i);
+    void Delete(Node** n) noexcept;
+
+    /**
+    * Accessors
+    *  Return nullptr if the requested item does not exist or if the tree is empty.
+    */
+    Node* operator[](K k) { return Search(k); }
+
+    Node* Search(K k, Node* n = nullptr) const;
+    Node* Minimum(Node* n = nullptr) const;
+    Node* Maximum(Node* n = nullptr) const;
+    Node* Predecessor(Node* n) const;
+    Node* Successor(Node* n) const;
+
+    std::vector<std::pair<K, I>> Walk() const;
+
+private:
+    static constexpr Index Nil{ std::numeric_limits<Index>::max() };
+    static constexpr std::size_t ChunkSize{ 256 };
+
+    Node* At(Index i) const { return Nil == i ? nullptr : &chunks[i / ChunkSize][i % ChunkSize]; }
+    Index Allocate(K k, I&& i);
+    void Deallocate(Index i) noexcept;   // Returns the slot to the free list threaded through 'left'.
+
+    std::vector<std::unique_ptr<Node[]>> chunks;
+    Index root;
+    Index available;
+    std::size_t used;                   // Slots handed out from the chunks, including freed ones.
+};
+
+template <typename K, class I, typename Index>
+CompactTree<K, I, Index>::CompactTree(CompactTree&& t) noexcept
+    : chunks{ std::move(t.chunks) }, root{ t.root }, available{ t.available }, used{ t.used } {
+    t.root = t.available = Nil;
+    t.used = 0;
+}
+
+template <typename K, class I, typename Index>
+CompactTree<K, I, Index>& CompactTree<K, I, Index>::operator=(CompactTree&& t) noexcept {
+    if (this != &t) {
+        chunks = std::move(t.chunks);
+        root = t.root;
+        available = t.available;
+        used = t.used;
+        t.root = t.available = Nil;
+        t.used = 0;
+    }
+    return *this;
+}
+
+template <typename K, class I, typename Index>
+std::vector<std::pair<K, I>> CompactTree<K, I, Index>::Walk() const {
+    std::vector<std::pair<K, I>> v;
+    for (Node* n = Minimum(); n; n = Successor(n)) {
+        v.emplace_back(n->key, n->item);
+    }
+    return v;
+}
+
+template <typename K, class I, typename Index>
+void CompactTree<K, I, Index>::Insert(K key, I&& item) {
+    Index insertion = Allocate(key, std::forward<I>(item));
+    if (Nil != insertion) {
+        Index* link = &root;
+        while (Nil != *link) {
+            Node* n = At(*link);
+            link = (key < n->key) ? &n->left : &n->right;
+        }
+        *link = insertion;
+    }
+}
+
+template <typename K, class I, typename Index>
+void CompactTree<K, I, Index>::Delete(Node** n) noexcept {
+    if (n != nullptr) {
+        if (Node* np = *n) {
+            // Locate the link referring to the node; it stands in for the parent pointer.
+            Index* link = &root;
+            while (Nil != *link && At(*link) != np) {
+                link = (np->key < At(*link)->key) ? &At(*link)->left : &At(*link)->right;
+            }
+            if (Nil == *link) {
+                return; // Not a node of this tree.
+            }
+            Index freed = *link;
+            if (Nil == np->left) {
+                *link = np->right;
+            }
+            else if (Nil == np->right) {
+                *link = np->left;
+            }
+            else {
+                Index* minLink = &np->right;
+                while (Nil != At(*minLink)->left) {
+                    minLink = &At(*minLink)->left;
+                }
+                Index min = *minLink;
+                *minLink = At(min)->right;
+                At(min)->left = np->left;
+                At(min)->right = np->right;
+                *link = min;
+            }
+            Deallocate(freed);
+            *n = nullptr;
+        }
+    }
+}
+
+template <typename K, class I, typename Index>
+typename CompactTree<K, I, Index>::Node* CompactTree<K, I, Index>::Search(K key, Node* n) const {
+    if (!n) {
+        n = At(root);
+    }
+    while (n && key != n->key) {
+        n = At((key < n->key) ? n->left : n->right);
+    }
+    return n;
+}
+
+template <typename K, class I, typename Index>
+typename CompactTree<K, I, Index>::Node* CompactTree<K, I, Index>::Minimum(Node* n) const {
+    if (!n) {
+        n = At(root);
+    }
+    while (n && Nil != n->left) {
+        n = At(n->left);
+    }
+    return n;
+}
+
+template <typename K, class I, typename Index>
+typename CompactTree<K, I, Index>::Node* CompactTree<K, I, Index>::Maximum(Node* n) const {
+    if (!n) {
+        n = At(root);
+    }
+    while (n && Nil != n->right) {
+        n = At(n->right);
+    }
+    return n;
+}
+
+/**
+*   Descends from the root toward the given node, remembering the last ancestor
+*   whose right subtree was entered; that ancestor is the predecessor when the
+*   node has no left subtree.
+*/
+template <typename K, class I, typename Index>
+typename CompactTree<K, I, Index>::Node* CompactTree<K, I, Index>::Predecessor(Node* found) const {
+    Node* candidate{};
+    Node* n = found ? At(root) : nullptr;
+    while (n && n != found) {
+        if (found->key < n->key) {
+            n = At(n->left);
+        }
+        else {
+            candidate = n;
+            n = At(n->right);
+        }
+    }
+    if (n && Nil != n->left) {
+        candidate = Maximum(At(n->left));
+    }
+    return n ? candidate : nullptr;
+}
+
+template <typename K, class I, typename Index>
+typename CompactTree<K, I, Index>::Node* CompactTree<K, I, Index>::Successor(Node* found) const {
+    Node* candidate{};
+    Node* n = found ? At(root) : nullptr;
+    while (n && n != found) {
+        if (found->key < n->key) {
+            candidate = n;
+            n = At(n->left);
+        }
+        else {
+            n = At(n->right);
+        }
+    }
+    if (n && Nil != n->right) {
+        candidate = Minimum(At(n->right));
+    }
+    return n ? candidate : nullptr;
+}
+
+template <typename K, class I, typename Index>
+Index CompactTree<K, I, Index>::Allocate(K key, I&& item) {
+    Index i = available;
+    if (Nil != i) {
+        available = At(i)->left;
+    }
+    else if (used < Nil) {
+        if (used == chunks.size() * ChunkSize) {
+            try {
+                chunks.emplace_back(new Node[ChunkSize]);
+            }
+            catch (std::bad_alloc& e) {
+                std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+                return Nil;
+            }
+        }
+        i = static_cast<Index>(used++);
+    }
+    else {
+        std::cerr << "Node index exhausted on line " << __LINE__ - 1 << " of " << __FILE__ << "." << std::endl;
+        return Nil;
+    }
+    Node* n = At(i);
+    n->key = key;
+    n->item = std::move(item);
+    n->left = n->right = Nil;
+    return i;
+}
+
+template <typename K, class I, typename Index>
+void CompactTree<K, I, Index>::Deallocate(Index i) noexcept {
+    Node* n = At(i);
+    n->item = I{};  // Releases resources held by the item; the slot itself is reused.
+    n->left = available;
+    n->right = Nil;
+    available = i;
+}
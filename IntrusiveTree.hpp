@@ -0,0 +1,247 @@
+#pragma once
+#include <vector>
+
+template <typename K, class T>
+class IntrusiveTree;
+
+/**
+*   Tree links embedded in a user type: struct Entry : TreeHook<Entry> { K key; ... };
+*   An object can be linked into at most one tree per hook it derives from.
+*/
+template <class T>
+struct TreeHook {
+    TreeHook() : parent{}, left{}, right{} {}
+    TreeHook(const TreeHook&) : TreeHook() {}  // Copies start out unlinked.
+    TreeHook& operator=(const TreeHook&) { return *this; }
+private:
+    T* parent;
+    T* left;
+    T* right;
+    template <typename, class> friend class IntrusiveTree;
+};
+
+/**
+*   Intrusive Unbalanced Binary Tree
+*    Links caller-owned objects of type T, which derive from TreeHook<T> and expose a
+*    'key' member. The tree never allocates, copies, or destroys objects; it only
+*    rewrites their hooks. Objects must stay alive and keep their key while linked.
+*/
+template <typename K, class T>
+class IntrusiveTree {
+public:
+    IntrusiveTree() : root{} {};
+    IntrusiveTree(IntrusiveTree&& t) noexcept : root{ t.root } { t.root = nullptr; }
+    IntrusiveTree(const IntrusiveTree&) = delete;
+    IntrusiveTree& operator=(const IntrusiveTree&) = delete;
+    ~IntrusiveTree() { Clear(); }
+
+    /**
+    * Modifiers
+    *  Insert() links an unlinked object; Remove() unlinks it, leaving it owned by the caller.
+    *  Clear() unlinks every object so that each may be inserted again. Insert() ignores
+    *  objects holding any link or already at the root; Remove() ignores objects that are
+    *  not linked; see IsLinked().
+    */
+    void Insert(T* t) noexcept;
+    void Remove(T* t) noexcept;
+    void Clear() noexcept;
+
+    /**
+    * Accessors
+    *  Return nullptr if the requested object does not exist or if the tree is empty.
+    */
+    T* operator[](K k) const { return Search(k); }
+
+    T* Search(K k, T* n = nullptr) const;
+    T* Minimum(T* n = nullptr) const;
+    T* Maximum(T* n = nullptr) const;
+    T* Predecessor(T* n) const;
+    T* Successor(T* n) const;
+    bool IsLinked(const T* t) const;    // Whether t has a parent or is this tree's root.
+
+    std::vector<T*> Walk() const;
+
+private:
+    using Hook = TreeHook<T>;
+    static Hook* H(T* t) { return static_cast<Hook*>(t); }
+    static const Hook* H(const T* t) { return static_cast<const Hook*>(t); }
+    void Transplant(T* m, T* n);  // Establishes mutual parent-child relationship; supports Remove().
+    T* root;
+};
+
+template <typename K, class T>
+std::vector<T*> IntrusiveTree<K, T>::Walk() const {
+    std::vector<T*> v;
+    for (T* n = Minimum(); n; n = Successor(n)) {
+        v.push_back(n);
+    }
+    return v;
+}
+
+template <typename K, class T>
+void IntrusiveTree<K, T>::Insert(T* insertion) noexcept {
+    if (insertion) {
+        Hook* h = H(insertion);
+        if (h->parent || h->left || h->right || root == insertion) {
+            return; // Already linked here or elsewhere.
+        }
+        if (T* m = root) {
+            T* n = m;
+            while (n) {
+                m = n;
+                n = (insertion->key < n->key) ? H(n)->left : H(n)->right;
+            }
+            if (insertion->key < m->key) {
+                H(m)->left = insertion;
+            }
+            else {
+                H(m)->right = insertion;
+            }
+            h->parent = m;
+        }
+        else {
+            root = insertion;
+        }
+    }
+}
+
+template <typename K, class T>
+void IntrusiveTree<K, T>::Remove(T* t) noexcept {
+    if (t && IsLinked(t)) {
+        Hook* h = H(t);
+        if (nullptr == h->left) {
+            Transplant(t, h->right);
+        }
+        else if (nullptr == h->right) {
+            Transplant(t, h->left);
+        }
+        else {
+            T* min = Minimum(h->right);
+            if (t != H(min)->parent) {
+                Transplant(min, H(min)->right);
+                H(min)->right = h->right;
+                H(H(min)->right)->parent = min;
+            }
+            Transplant(t, min);
+            H(min)->left = h->left;
+            H(H(min)->left)->parent = min;
+        }
+        h->parent = h->left = h->right = nullptr;
+    }
+}
+
+template <typename K, class T>
+void IntrusiveTree<K, T>::Clear() noexcept {
+    // Unlinks bottom-up, reusing the parent links in place of a stack.
+    T* n = root;
+    while (n) {
+        Hook* h = H(n);
+        if (h->left) {
+            n = h->left;
+        }
+        else if (h->right) {
+            n = h->right;
+        }
+        else {
+            T* parent = h->parent;
+            if (parent) {
+                (H(parent)->left == n ? H(parent)->left : H(parent)->right) = nullptr;
+            }
+            h->parent = nullptr;
+            n = parent;
+        }
+    }
+    root = nullptr;
+}
+
+template <typename K, class T>
+T* IntrusiveTree<K, T>::Search(K key, T* n) const {
+    if (!n) {
+        n = root;
+    }
+    while (n && key != n->key) {
+        n = (key < n->key) ? H(n)->left : H(n)->right;
+    }
+    return n;
+}
+
+template <typename K, class T>
+T* IntrusiveTree<K, T>::Minimum(T* n) const {
+    if (!n) {
+        n = root;
+    }
+    while (n && H(n)->left) {
+        n = H(n)->left;
+    }
+    return n;
+}
+
+template <typename K, class T>
+T* IntrusiveTree<K, T>::Maximum(T* n) const {
+    if (!n) {
+        n = root;
+    }
+    while (n && H(n)->right) {
+        n = H(n)->right;
+    }
+    return n;
+}
+
+template <typename K, class T>
+T* IntrusiveTree<K, T>::Predecessor(T* found) const {
+    if (T* n = found) {
+        if (H(n)->left) {
+            found = Maximum(H(n)->left);
+        }
+        else {
+            while (H(n)->parent && n != H(H(n)->parent)->right) {
+                n = H(n)->parent;
+            }
+            found = H(n)->parent;
+        }
+    }
+    return found;
+}
+
+template <typename K, class T>
+T* IntrusiveTree<K, T>::Successor(T* found) const {
+    if (T* n = found) {
+        if (H(n)->right) {
+            found = Minimum(H(n)->right);
+        }
+        else {
+            while (H(n)->parent && n != H(H(n)->parent)->left) {
+                n = H(n)->parent;
+            }
+            found = H(n)->parent;
+        }
+    }
+    return found;
+}
+
+/**
+*   A linked object other than the root always has a parent, so an object with neither
+*   is unlinked or the root of another tree. Objects linked below another tree's root
+*   cannot be told apart from this tree's without a walk and must not be passed in.
+*/
+template <typename K, class T>
+bool IntrusiveTree<K, T>::IsLinked(const T* t) const {
+    return t && (H(t)->parent || root == t);
+}
+
+template <typename K, class T>
+void IntrusiveTree<K, T>::Transplant(T* m, T* n) {
+    T* parent = H(m)->parent;
+    if (n) {
+        H(n)->parent = parent;
+    }
+    if (nullptr == parent) {
+        root = n;
+    }
+    else if (m == H(parent)->right) {
+        H(parent)->right = n;
+    }
+    else {
+        H(parent)->left = n;
+    }
+}
@@ -0,0 +1,453 @@
+#pragma once
+#include "Node.hpp"
+#include "NodePool.hpp"
+#include <type_traits>
+
+/**
+*   Pooled Linked Lists
+*    ForwardList links DirectedNode, List links BiDirectionalNode, and UnrolledList packs
+*    up to Capacity items into each DirectedNode. Nodes come from a NodePool that lists
+*    may share: Splice() between lists sharing a pool relinks nodes in O(1), otherwise
+*    it moves items across one at a time, stopping if an allocation fails. Clear() hands
+*    all nodes back to the pool at once when items are trivially destructible, whether
+*    or not the pool is shared; a pool's only user also restarts carving from its first
+*    chunk.
+*    Moving a list hands its pool to the new list; the moved-from list may only be
+*    destroyed.
+*/
+template <typename I>
+class ForwardList {
+public:
+    using Node = DirectedNode<I>;
+    using Pool = NodePool<Node>;
+
+    ForwardList() : ForwardList(std::make_shared<Pool>()) {}
+    explicit ForwardList(std::shared_ptr<Pool> p) : pool{ std::move(p) }, head{}, tail{}, size{} {}
+    ForwardList(ForwardList&& l) noexcept;
+    ~ForwardList() { Clear(); }
+
+    /**
+    * Modifiers
+    */
+    void PushFront(I&& i);
+    void PushBack(I&& i);
+    void PopFront() noexcept;
+    void Splice(ForwardList& l);    // Appends every node of 'l', leaving it empty.
+    void Clear() noexcept;
+
+    /**
+    * Accessors
+    *  Return nullptr if the list is empty.
+    */
+    Node* Front() const { return head; }
+    Node* Back() const { return tail; }
+    std::size_t Size() const { return size; }
+    bool Empty() const { return 0 == size; }
+    const std::shared_ptr<Pool>& Share() const { return pool; }
+
+private:
+    std::shared_ptr<Pool> pool;
+    Node* head;
+    Node* tail;
+    std::size_t size;
+};
+
+template <typename I>
+ForwardList<I>::ForwardList(ForwardList&& l) noexcept
+    : pool{ std::move(l.pool) }, head{ l.head }, tail{ l.tail }, size{ l.size } {
+    l.head = l.tail = nullptr;
+    l.size = 0;
+}
+
+template <typename I>
+void ForwardList<I>::PushFront(I&& item) {
+    if (Node* n = pool->Allocate(std::forward<I>(item))) {
+        n->next = head;
+        head = n;
+        if (!tail) {
+            tail = n;
+        }
+        ++size;
+    }
+}
+
+template <typename I>
+void ForwardList<I>::PushBack(I&& item) {
+    if (Node* n = pool->Allocate(std::forward<I>(item))) {
+        if (tail) {
+            tail->next = n;
+        }
+        else {
+            head = n;
+        }
+        tail = n;
+        ++size;
+    }
+}
+
+template <typename I>
+void ForwardList<I>::PopFront() noexcept {
+    if (Node* n = head) {
+        head = n->next;
+        if (!head) {
+            tail = nullptr;
+        }
+        pool->Deallocate(n);
+        --size;
+    }
+}
+
+template <typename I>
+void ForwardList<I>::Splice(ForwardList& l) {
+    if (this == &l || !l.head) {
+        return;
+    }
+    if (pool == l.pool) {
+        if (tail) {
+            tail->next = l.head;
+        }
+        else {
+            head = l.head;
+        }
+        tail = l.tail;
+        size += l.size;
+        l.head = l.tail = nullptr;
+        l.size = 0;
+    }
+    else {
+        for (std::size_t moved = size; Node* n = l.head; moved = size) {
+            PushBack(std::move(n->item));
+            if (moved == size) {
+                break;  // Allocation failed; the rest stays in 'l'.
+            }
+            l.PopFront();
+        }
+    }
+}
+
+template <typename I>
+void ForwardList<I>::Clear() noexcept {
+    if (!pool) {
+        return;     // Moved from.
+    }
+    if (std::is_trivially_destructible_v<I>) {
+        pool->DeallocateChain(head, tail);
+    }
+    else {
+        while (head) {
+            PopFront();
+        }
+    }
+    if (pool.use_count() == 1) {
+        pool->Reset();  // Restarts carving from the first chunk.
+    }
+    head = tail = nullptr;
+    size = 0;
+}
+
+template <typename I>
+class List {
+public:
+    using Node = BiDirectionalNode<I>;
+    using Pool = NodePool<Node>;
+
+    List() : List(std::make_shared<Pool>()) {}
+    explicit List(std::shared_ptr<Pool> p) : pool{ std::move(p) }, head{}, tail{}, size{} {}
+    List(List&& l) noexcept;
+    ~List() { Clear(); }
+
+    /**
+    * Modifiers
+    *  Delete() unlinks and frees the node, nulling the caller's pointer.
+    */
+    void PushFront(I&& i);
+    void PushBack(I&& i);
+    void Insert(Node* position, I&& i);     // Inserts before 'position', or at the back if null.
+    void PopFront() noexcept;
+    void PopBack() noexcept;
+    void Delete(Node** n) noexcept;
+    void Splice(Node* position, List& l);   // Moves every node of 'l' before 'position', or to the back.
+    void Clear() noexcept;
+
+    /**
+    * Accessors
+    *  Return nullptr if the list is empty.
+    */
+    Node* Front() const { return head; }
+    Node* Back() const { return tail; }
+    std::size_t Size() const { return size; }
+    bool Empty() const { return 0 == size; }
+    const std::shared_ptr<Pool>& Share() const { return pool; }
+
+private:
+    void Link(Node* position, Node* first, Node* last) noexcept;
+    std::shared_ptr<Pool> pool;
+    Node* head;
+    Node* tail;
+    std::size_t size;
+};
+
+template <typename I>
+List<I>::List(List&& l) noexcept
+    : pool{ std::move(l.pool) }, head{ l.head }, tail{ l.tail }, size{ l.size } {
+    l.head = l.tail = nullptr;
+    l.size = 0;
+}
+
+template <typename I>
+void List<I>::PushFront(I&& item) {
+    Insert(head, std::forward<I>(item));
+}
+
+template <typename I>
+void List<I>::PushBack(I&& item) {
+    Insert(nullptr, std::forward<I>(item));
+}
+
+template <typename I>
+void List<I>::Insert(Node* position, I&& item) {
+    if (Node* n = pool->Allocate(std::forward<I>(item))) {
+        Link(position, n, n);
+        ++size;
+    }
+}
+
+template <typename I>
+void List<I>::PopFront() noexcept {
+    Node* n = head;
+    Delete(&n);
+}
+
+template <typename I>
+void List<I>::PopBack() noexcept {
+    Node* n = tail;
+    Delete(&n);
+}
+
+template <typename I>
+void List<I>::Delete(Node** n) noexcept {
+    if (n != nullptr) {
+        if (Node* np = *n) {
+            (np->prev ? np->prev->next : head) = np->next;
+            (np->next ? np->next->prev : tail) = np->prev;
+            pool->Deallocate(np);
+            --size;
+            *n = nullptr;
+        }
+    }
+}
+
+template <typename I>
+void List<I>::Splice(Node* position, List& l) {
+    if (this == &l || !l.head) {
+        return;
+    }
+    if (pool == l.pool) {
+        Link(position, l.head, l.tail);
+        size += l.size;
+        l.head = l.tail = nullptr;
+        l.size = 0;
+    }
+    else {
+        for (std::size_t moved = size; Node* n = l.head; moved = size) {
+            Insert(position, std::move(n->item));
+            if (moved == size) {
+                break;
+            }
+            l.PopFront();
+        }
+    }
+}
+
+template <typename I>
+void List<I>::Clear() noexcept {
+    if (!pool) {
+        return;
+    }
+    if (std::is_trivially_destructible_v<I>) {
+        pool->DeallocateChain(head, tail);
+    }
+    else {
+        while (head) {
+            PopFront();
+        }
+    }
+    if (pool.use_count() == 1) {
+        pool->Reset();
+    }
+    head = tail = nullptr;
+    size = 0;
+}
+
+template <typename I>
+void List<I>::Link(Node* position, Node* first, Node* last) noexcept {
+    Node* prev = position ? position->prev : tail;
+    first->prev = prev;
+    last->next = position;
+    (prev ? prev->next : head) = first;
+    (position ? position->prev : tail) = last;
+}
+
+/**
+*   UnrolledList packs items into blocks so a node is allocated once per Capacity pushes
+*   and neighbouring items share cache lines. Items occupy [begin, end) of each block.
+*/
+template <typename I, std::size_t Capacity = 16>
+class UnrolledList {
+public:
+    struct Block {
+        Block() : items{}, begin{}, end{} {}
+        I items[Capacity];
+        std::size_t begin;
+        std::size_t end;
+    };
+    using Node = DirectedNode<Block>;
+    using Pool = NodePool<Node>;
+
+    UnrolledList() : UnrolledList(std::make_shared<Pool>()) {}
+    explicit UnrolledList(std::shared_ptr<Pool> p) : pool{ std::move(p) }, head{}, tail{}, size{} {}
+    UnrolledList(UnrolledList&& l) noexcept;
+    ~UnrolledList() { Clear(); }
+
+    /**
+    * Modifiers
+    */
+    void PushFront(I&& i);
+    void PushBack(I&& i);
+    void PopFront() noexcept;
+    void Splice(UnrolledList& l);   // Appends every block of 'l', leaving it empty.
+    void Clear() noexcept;
+
+    /**
+    * Accessors
+    *  Return nullptr if the list is empty.
+    */
+    I* Front() const { return head ? &head->item.items[head->item.begin] : nullptr; }
+    I* Back() const { return tail ? &tail->item.items[tail->item.end - 1] : nullptr; }
+    std::size_t Size() const { return size; }
+    bool Empty() const { return 0 == size; }
+    const std::shared_ptr<Pool>& Share() const { return pool; }
+
+    template <class F>
+    void ForEach(F visit) const;    // Calls visit(I&) on each item in order.
+
+private:
+    Node* Allocate();
+    std::shared_ptr<Pool> pool;
+    Node* head;
+    Node* tail;
+    std::size_t size;
+};
+
+template <typename I, std::size_t Capacity>
+UnrolledList<I, Capacity>::UnrolledList(UnrolledList&& l) noexcept
+    : pool{ std::move(l.pool) }, head{ l.head }, tail{ l.tail }, size{ l.size } {
+    l.head = l.tail = nullptr;
+    l.size = 0;
+}
+
+template <typename I, std::size_t Capacity>
+void UnrolledList<I, Capacity>::PushFront(I&& item) {
+    if (!head || 0 == head->item.begin) {
+        Node* n = Allocate();
+        if (!n) {
+            return;
+        }
+        n->item.begin = n->item.end = Capacity;   // Fills from the back toward the front.
+        n->next = head;
+        head = n;
+        if (!tail) {
+            tail = n;
+        }
+    }
+    head->item.items[--head->item.begin] = std::move(item);
+    ++size;
+}
+
+template <typename I, std::size_t Capacity>
+void UnrolledList<I, Capacity>::PushBack(I&& item) {
+    if (!tail || Capacity == tail->item.end) {
+        Node* n = Allocate();
+        if (!n) {
+            return;
+        }
+        (tail ? tail->next : head) = n;
+        tail = n;
+    }
+    tail->item.items[tail->item.end++] = std::move(item);
+    ++size;
+}
+
+template <typename I, std::size_t Capacity>
+void UnrolledList<I, Capacity>::PopFront() noexcept {
+    if (Node* n = head) {
+        n->item.items[n->item.begin++] = I{};   // Releases resources held by the item.
+        --size;
+        if (n->item.begin == n->item.end) {
+            head = n->next;
+            if (!head) {
+                tail = nullptr;
+            }
+            pool->Deallocate(n);
+        }
+    }
+}
+
+template <typename I, std::size_t Capacity>
+void UnrolledList<I, Capacity>::Splice(UnrolledList& l) {
+    if (this == &l || !l.head) {
+        return;
+    }
+    if (pool == l.pool) {
+        (tail ? tail->next : head) = l.head;
+        tail = l.tail;
+        size += l.size;
+        l.head = l.tail = nullptr;
+        l.size = 0;
+    }
+    else {
+        for (std::size_t moved = size; I* i = l.Front(); moved = size) {
+            PushBack(std::move(*i));
+            if (moved == size) {
+                break;
+            }
+            l.PopFront();
+        }
+    }
+}
+
+template <typename I, std::size_t Capacity>
+void UnrolledList<I, Capacity>::Clear() noexcept {
+    if (!pool) {
+        return;
+    }
+    if (std::is_trivially_destructible_v<I>) {
+        pool->DeallocateChain(head, tail);
+    }
+    else {
+        while (Node* n = head) {
+            head = n->next;
+            pool->Deallocate(n);
+        }
+    }
+    if (pool.use_count() == 1) {
+        pool->Reset();
+    }
+    head = tail = nullptr;
+    size = 0;
+}
+
+template <typename I, std::size_t Capacity>
+template <class F>
+void UnrolledList<I, Capacity>::ForEach(F visit) const {
+    for (Node* n = head; n; n = n->next) {
+        for (std::size_t i = n->item.begin; i < n->item.end; ++i) {
+            visit(n->item.items[i]);
+        }
+    }
+}
+
+template <typename I, std::size_t Capacity>
+typename UnrolledList<I, Capacity>::Node* UnrolledList<I, Capacity>::Allocate() {
+    return pool->Allocate(Block{});
+}
@@ -1,10 +1,11 @@
 #pragma once
+#include <utility>
 template <typename I>
 struct BaseNode {
     I item;
     virtual ~BaseNode() {}
 protected:
-    BaseNode(I&& i) : item{ i } {}
+    BaseNode(I&& i) : item{ std::move(i) } {}
 
     template <class N>
     static N* Allocate(I&& i) { return new N{ std::move(i) }; }
@@ -0,0 +1,107 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+*   Chunked Node Pool
+*    Hands out storage for nodes of type N from chunks of ChunkSize slots, recycling
+*    freed slots through an intrusive free list. Chunks are only returned to the system
+*    when the pool is destroyed. Reset() recycles every slot at once without visiting
+*    them, and DeallocateChain() recycles a run of nodes linked through N::next; in both
+*    cases the nodes are not destroyed, so their destructors must have no effect that
+*    matters. A recycled chain is consumed node by node as slots are allocated.
+*/
+template <class N, std::size_t ChunkSize = 64>
+class NodePool {
+public:
+    NodePool() : chunks{}, available{}, chain{}, current{}, used{} {}
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+    *  Constructs a node in a free slot; returns nullptr if memory is exhausted.
+    */
+    template <typename... A>
+    N* Allocate(A&&... a);
+    void Deallocate(N* n) noexcept;
+    void DeallocateChain(N* first, N* last) noexcept;   // O(1); 'last' must be reachable from 'first'.
+    void Reset() noexcept;
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(N) unsigned char storage[sizeof(N)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+    Slot* available;        // Recycled slots.
+    N* chain;               // Recycled nodes still linked through N::next.
+    std::size_t current;    // Chunk being carved.
+    std::size_t used;       // Slots carved from the current chunk.
+};
+
+template <class N, std::size_t ChunkSize>
+template <typename... A>
+N* NodePool<N, ChunkSize>::Allocate(A&&... a) {
+    Slot* slot = available;
+    if (slot) {
+        available = slot->next;
+    }
+    else if (N* n = chain) {
+        chain = static_cast<N*>(n->next);
+        slot = reinterpret_cast<Slot*>(n);
+    }
+    else {
+        if (ChunkSize == used) {
+            ++current;
+            used = 0;
+        }
+        if (chunks.size() == current) {
+            try {
+                chunks.emplace_back(new Slot[ChunkSize]);
+            }
+            catch (std::bad_alloc& e) {
+                std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+                return nullptr;
+            }
+        }
+        slot = &chunks[current][used++];
+    }
+    try {
+        return new (slot->storage) N(std::forward<A>(a)...);
+    }
+    catch (std::bad_alloc& e) {
+        std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+        slot->next = available;
+        available = slot;
+        return nullptr;
+    }
+}
+
+template <class N, std::size_t ChunkSize>
+void NodePool<N, ChunkSize>::Deallocate(N* n) noexcept {
+    if (n) {
+        n->~N();
+        Slot* slot = reinterpret_cast<Slot*>(n);
+        slot->next = available;
+        available = slot;
+    }
+}
+
+template <class N, std::size_t ChunkSize>
+void NodePool<N, ChunkSize>::DeallocateChain(N* first, N* last) noexcept {
+    if (first && last) {
+        last->next = chain;
+        chain = first;
+    }
+}
+
+template <class N, std::size_t ChunkSize>
+void NodePool<N, ChunkSize>::Reset() noexcept {
+    available = nullptr;
+    chain = nullptr;
+    current = 0;
+    used = 0;
+}
@@ -0,0 +1,264 @@
+#pragma once
+#include "Node.hpp"
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/**
+*   Persistent Unbalanced Binary Tree
+*    Every modifier returns a new version of the tree and leaves the original untouched.
+*    Versions share all nodes off the modified path (path copying), so taking a snapshot
+*    is a copy of the root handle and each update allocates one node per level descended.
+*    Nodes are reference counted and are released once no version refers to them.
+*/
+template <typename K, class I>
+class PersistentTree {
+public:
+    struct Node : BaseNode<I> {
+        K key;
+    private:
+        using Link = std::shared_ptr<const Node>;
+        Node(K k, I&& i) : BaseNode<I>(std::forward<I>(i)), key{ k }, left{}, right{} {}
+        Node(const Node& n) : BaseNode<I>(I{ n.item }), key{ n.key }, left{ n.left }, right{ n.right } {}
+        Link left;
+        Link right;
+        friend class PersistentTree;
+    };
+
+    PersistentTree() : root{} {};
+
+    /**
+    * Modifiers
+    *  Return the updated version; the tree operated on is unchanged.
+    */
+    PersistentTree Insert(K k, I&& i) const;
+    PersistentTree Delete(K k) const;
+
+    /**
+    * Accessors
+    *  Return nullptr if the requested item does not exist or if the tree is empty.
+    *  Returned nodes remain valid for as long as this version is alive.
+    */
+    const Node* operator[](K k) const { return Search(k); }
+
+    const Node* Search(K k) const;
+    const Node* Minimum() const;
+    const Node* Maximum() const;
+    const Node* Predecessor(const Node* n) const;
+    const Node* Successor(const Node* n) const;
+
+    std::vector<std::pair<K, I>> Walk() const;
+
+private:
+    using Link = typename Node::Link;
+    using Mutable = std::shared_ptr<Node>;
+
+    explicit PersistentTree(Link r) : root{ std::move(r) } {}
+    static Mutable Allocate(K k, I&& i);
+    static Mutable Copy(const Link& n);
+    static Link Insert(const Link& n, K k, I&& i);
+    static Link Delete(const Link& n, K k, bool& found);
+    static Link DeleteMinimum(const Link& n, Link& min);
+    Link root;
+};
+
+template <typename K, class I>
+std::vector<std::pair<K, I>> PersistentTree<K, I>::Walk() const {
+    std::vector<std::pair<K, I>> v;
+    for (const Node* n = Minimum(); n; n = Successor(n)) {
+        v.emplace_back(n->key, n->item);
+    }
+    return v;
+}
+
+template <typename K, class I>
+PersistentTree<K, I> PersistentTree<K, I>::Insert(K key, I&& item) const {
+    if (Link r = Insert(root, key, std::forward<I>(item))) {
+        return PersistentTree{ std::move(r) };
+    }
+    return *this;
+}
+
+template <typename K, class I>
+PersistentTree<K, I> PersistentTree<K, I>::Delete(K key) const {
+    bool found{};
+    Link r = Delete(root, key, found);
+    if (found) {
+        return PersistentTree{ std::move(r) };
+    }
+    return *this; // Nothing to remove; share the whole version.
+}
+
+template <typename K, class I>
+const typename PersistentTree<K, I>::Node* PersistentTree<K, I>::Search(K key) const {
+    const Node* n = root.get();
+    while (n && key != n->key) {
+        n = (key < n->key) ? n->left.get() : n->right.get();
+    }
+    return n;
+}
+
+template <typename K, class I>
+const typename PersistentTree<K, I>::Node* PersistentTree<K, I>::Minimum() const {
+    const Node* n = root.get();
+    while (n && n->left) {
+        n = n->left.get();
+    }
+    return n;
+}
+
+template <typename K, class I>
+const typename PersistentTree<K, I>::Node* PersistentTree<K, I>::Maximum() const {
+    const Node* n = root.get();
+    while (n && n->right) {
+        n = n->right.get();
+    }
+    return n;
+}
+
+/**
+*   Without parent links, Predecessor() and Successor() descend from the root toward the
+*   given node, remembering the last ancestor entered from the appropriate side.
+*/
+template <typename K, class I>
+const typename PersistentTree<K, I>::Node* PersistentTree<K, I>::Predecessor(const Node* found) const {
+    const Node* candidate{};
+    const Node* n = root.get();
+    while (n && n != found) {
+        if (found->key < n->key) {
+            n = n->left.get();
+        }
+        else {
+            candidate = n;
+            n = n->right.get();
+        }
+    }
+    if (n && n->left) {
+        for (n = n->left.get(); n->right; n = n->right.get()) {}
+        candidate = n;
+    }
+    return n ? candidate : nullptr;
+}
+
+template <typename K, class I>
+const typename PersistentTree<K, I>::Node* PersistentTree<K, I>::Successor(const Node* found) const {
+    const Node* candidate{};
+    const Node* n = root.get();
+    while (n && n != found) {
+        if (found->key < n->key) {
+            candidate = n;
+            n = n->left.get();
+        }
+        else {
+            n = n->right.get();
+        }
+    }
+    if (n && n->right) {
+        for (n = n->right.get(); n->left; n = n->left.get()) {}
+        candidate = n;
+    }
+    return n ? candidate : nullptr;
+}
+
+template <typename K, class I>
+typename PersistentTree<K, I>::Mutable PersistentTree<K, I>::Allocate(K key, I&& item) {
+    try {
+        return Mutable{ new Node{ key, std::forward<I>(item) } };
+    }
+    catch (std::bad_alloc& e) {
+        std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+        return nullptr;
+    }
+}
+
+template <typename K, class I>
+typename PersistentTree<K, I>::Mutable PersistentTree<K, I>::Copy(const Link& n) {
+    try {
+        return Mutable{ new Node{ *n } };
+    }
+    catch (std::bad_alloc& e) {
+        std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+        return nullptr;
+    }
+}
+
+/**
+*   Returns the root of the new path, or nullptr if an allocation failed.
+*/
+template <typename K, class I>
+typename PersistentTree<K, I>::Link PersistentTree<K, I>::Insert(const Link& n, K key, I&& item) {
+    if (!n) {
+        return Allocate(key, std::forward<I>(item));
+    }
+    Link child = Insert((key < n->key) ? n->left : n->right, key, std::forward<I>(item));
+    if (!child) {
+        return nullptr;
+    }
+    Mutable m = Copy(n);
+    if (m) {
+        ((key < n->key) ? m->left : m->right) = std::move(child);
+    }
+    return m;
+}
+
+/**
+*   Sets 'found' and returns the root of the new path; on allocation failure 'found' is
+*   cleared so the caller keeps the original version.
+*/
+template <typename K, class I>
+typename PersistentTree<K, I>::Link PersistentTree<K, I>::Delete(const Link& n, K key, bool& found) {
+    if (!n) {
+        found = false;
+        return nullptr;
+    }
+    if (key == n->key) {
+        found = true;
+        if (!n->left) {
+            return n->right;
+        }
+        if (!n->right) {
+            return n->left;
+        }
+        Link min;
+        Link right = DeleteMinimum(n->right, min);
+        Mutable m = min ? Copy(min) : nullptr;
+        if (!m) {
+            found = false;
+            return nullptr;
+        }
+        m->left = n->left;
+        m->right = std::move(right);
+        return m;
+    }
+    bool left = key < n->key;
+    Link child = Delete(left ? n->left : n->right, key, found);
+    if (!found) {
+        return nullptr;
+    }
+    Mutable m = Copy(n);
+    if (!m) {
+        found = false;
+        return nullptr;
+    }
+    (left ? m->left : m->right) = std::move(child);
+    return m;
+}
+
+/**
+*   Removes the minimum of subtree 'n', returning it through 'min' (nullptr on failure).
+*/
+template <typename K, class I>
+typename PersistentTree<K, I>::Link PersistentTree<K, I>::DeleteMinimum(const Link& n, Link& min) {
+    if (!n->left) {
+        min = n;
+        return n->right;
+    }
+    Link child = DeleteMinimum(n->left, min);
+    Mutable m = min ? Copy(n) : nullptr;
+    if (!m) {
+        min = nullptr;
+        return nullptr;
+    }
+    m->left = std::move(child);
+    return m;
+}
@@ -0,0 +1,742 @@
+#pragma once
+#include "Node.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+*   Binary-comparable key encodings for RadixTree
+*    Encode() appends bytes whose lexicographic (unsigned) order matches the key order.
+*    Integers are stored big-endian with the sign bit flipped. Strings store each
+*    character big-endian followed by a zero character, so no key is a prefix of
+*    another; strings holding embedded zero characters are not supported.
+*/
+template <typename K, typename = void>
+struct RadixKey;
+
+template <typename K>
+struct RadixKey<K, std::enable_if_t<std::is_integral_v<K> && !std::is_same_v<K, bool>>> {
+    static void Encode(K k, std::string& out) {
+        using U = std::make_unsigned_t<K>;
+        U u = static_cast<U>(k);
+        if constexpr (std::is_signed_v<K>) {
+            u ^= static_cast<U>(U{ 1 } << (sizeof(K) * 8 - 1));
+        }
+        for (std::size_t i = sizeof(K); i-- > 0;) {
+            out.push_back(static_cast<char>((u >> (i * 8)) & 0xFF));
+        }
+    }
+};
+
+template <typename C, class T, class A>
+struct RadixKey<std::basic_string<C, T, A>> {
+    static void Encode(const std::basic_string<C, T, A>& k, std::string& out) {
+        out.reserve(out.size() + (k.size() + 1) * sizeof(C));
+        for (C c : k) {
+            RadixKey<C>::Encode(static_cast<C>(c), out);
+        }
+        out.append(sizeof(C), '\0');
+    }
+};
+
+template <>
+struct RadixKey<wchar_t> {
+    static void Encode(wchar_t c, std::string& out) {
+        // Characters order as unsigned code units, whatever the signedness of wchar_t.
+        using U = std::conditional_t<sizeof(wchar_t) == 2, std::uint16_t, std::uint32_t>;
+        U u = static_cast<U>(c);
+        for (std::size_t i = sizeof(U); i-- > 0;) {
+            out.push_back(static_cast<char>((u >> (i * 8)) & 0xFF));
+        }
+    }
+};
+
+/**
+*   Adaptive Radix Tree
+*    Ordered map over the bytes of RadixKey<K>::Encode(). Inner nodes grow from 4 to 16,
+*    48 and 256 children as their fan-out increases and shrink back as it drops; chains
+*    of single-child nodes are collapsed into a prefix stored on the next inner node
+*    (path compression). Descent costs one step per distinguishing byte instead of a
+*    full key comparison per level. Keys are unique: inserting an existing key replaces
+*    its item.
+*/
+template <typename K, class I>
+class RadixTree {
+public:
+    struct Node : BaseNode<I> {
+        K key;
+    private:
+        Node(K k, std::string b, I&& i) : BaseNode<I>(std::forward<I>(i)), key{ k }, bytes{ std::move(b) } {}
+        std::string bytes;
+        friend class RadixTree;
+    };
+
+    RadixTree() : root{}, size{} {};
+    RadixTree(RadixTree&& t) noexcept : root{ t.root }, size{ t.size } { t.root = nullptr; t.size = 0; }
+    RadixTree(const RadixTree&) = delete;
+    RadixTree& operator=(const RadixTree&) = delete;
+    ~RadixTree() { Release(root); }
+
+    /**
+    * Modifiers
+    */
+    void Insert(K k, I&& i);
+    void Delete(Node** n) noexcept;
+
+    /**
+    * Accessors
+    *  Return nullptr if the requested item does not exist or if the tree is empty.
+    */
+    Node* operator[](K k) const { return Search(k); }
+
+    Node* Search(K k) const;
+    Node* Minimum() const { return root ? Minimum(root) : nullptr; }
+    Node* Maximum() const { return root ? Maximum(root) : nullptr; }
+    Node* Predecessor(Node* n) const { return n && root ? Floor(root, n->bytes, 0) : nullptr; }
+    Node* Successor(Node* n) const { return n && root ? Ceiling(root, n->bytes, 0, true) : nullptr; }
+    Node* LowerBound(K k) const;    // First node whose key is not less than k.
+
+    /**
+    * Range Scan
+    *  Calls visit(Node*) in key order for each node whose key lies in [lo, hi], stopping
+    *  early once visit returns false. Returns the number of nodes visited.
+    */
+    template <class F>
+    std::size_t ForEachInRange(K lo, K hi, F visit) const;
+
+    std::size_t Size() const { return size; }
+    std::vector<std::pair<K, I>> Walk() const;
+
+private:
+    /**
+    *  Child links point either to an inner node or, with the low bit set, to a leaf.
+    */
+    using Link = void*;
+    enum class Kind : unsigned char { N4, N16, N48, N256 };
+
+    struct Inner {
+        Inner(Kind k) : kind{ k }, count{}, prefix{} {}
+        Kind kind;
+        unsigned short count;
+        std::string prefix;     // Bytes shared by every key below, after the parent's byte.
+    };
+    template <std::size_t C, Kind T>
+    struct Sorted : Inner {     // Keys kept in ascending order.
+        Sorted() : Inner(T), keys{}, children{} {}
+        unsigned char keys[C];
+        Link children[C];
+    };
+    using Inner4 = Sorted<4, Kind::N4>;
+    using Inner16 = Sorted<16, Kind::N16>;
+    struct Inner48 : Inner {
+        Inner48() : Inner(Kind::N48), index{}, children{} {}
+        unsigned char index[256];   // Slot + 1 in 'children', or 0 when absent.
+        Link children[48];
+    };
+    struct Inner256 : Inner {
+        Inner256() : Inner(Kind::N256), children{} {}
+        Link children[256];
+    };
+
+    static bool IsLeaf(Link l) { return reinterpret_cast<std::uintptr_t>(l) & 1; }
+    static Node* Leaf(Link l) { return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(l) & ~std::uintptr_t{ 1 }); }
+    static Link Tag(Node* n) { return reinterpret_cast<Link>(reinterpret_cast<std::uintptr_t>(n) | 1); }
+    static Inner* Branch(Link l) { return static_cast<Inner*>(l); }
+    static Link Untag(Inner* n) { return static_cast<Link>(n); }
+    static std::string Encode(const K& k) { std::string b; RadixKey<K>::Encode(k, b); return b; }
+
+    Node* Allocate(K k, std::string b, I&& i);
+    template <class N>
+    static N* Make() noexcept;
+    static void Free(Inner* n) noexcept;
+    static void Release(Link l) noexcept;
+    static std::size_t Capacity(const Inner* n);
+
+    static Link* Find(Inner* n, unsigned char b);
+    static void Put(Inner* n, unsigned char b, Link child);
+    static void Take(Inner* n, unsigned char b);
+    template <class F>
+    static void ForEachChild(Inner* n, F f);
+    static Link First(Inner* n);
+    static Link Last(Inner* n);
+    static Link Above(Inner* n, unsigned char b);
+    static Link Below(Inner* n, unsigned char b);
+
+    static bool Add(Link& ref, unsigned char b, Link child) noexcept;     // Grows if full.
+    static void Remove(Link& ref, unsigned char b) noexcept;              // Shrinks or collapses.
+    template <class N>
+    static Inner* Resize(Inner* n) noexcept;
+
+    static Node* Minimum(Link l);
+    static Node* Maximum(Link l);
+    static Node* Ceiling(Link l, const std::string& b, std::size_t depth, bool strict);
+    static Node* Floor(Link l, const std::string& b, std::size_t depth);
+
+    Link root;
+    std::size_t size;
+};
+
+template <typename K, class I>
+std::vector<std::pair<K, I>> RadixTree<K, I>::Walk() const {
+    std::vector<std::pair<K, I>> v;
+    for (Node* n = Minimum(); n; n = Successor(n)) {
+        v.emplace_back(n->key, n->item);
+    }
+    return v;
+}
+
+template <typename K, class I>
+void RadixTree<K, I>::Insert(K key, I&& item) {
+    std::string bytes = Encode(key);
+    Node* leaf = Allocate(key, std::move(bytes), std::forward<I>(item));
+    if (!leaf) {
+        return;
+    }
+    Link* ref = &root;
+    std::size_t depth{};
+    while (*ref) {
+        if (IsLeaf(*ref)) {
+            Node* other = Leaf(*ref);
+            if (other->bytes == leaf->bytes) {
+                other->item = std::move(leaf->item);
+                delete leaf;
+                return;
+            }
+            // Two leaves diverge: a new node holds their common bytes as its prefix.
+            std::size_t p = depth;
+            std::size_t shorter = std::min(other->bytes.size(), leaf->bytes.size()) - 1;
+            while (p < shorter && other->bytes[p] == leaf->bytes[p]) {
+                ++p;
+            }
+            Inner4* n = Make<Inner4>();
+            if (!n) {
+                delete leaf;
+                return;
+            }
+            n->prefix = leaf->bytes.substr(depth, p - depth);
+            Put(n, static_cast<unsigned char>(other->bytes[p]), *ref);
+            Put(n, static_cast<unsigned char>(leaf->bytes[p]), Tag(leaf));
+            *ref = Untag(n);
+            ++size;
+            return;
+        }
+        Inner* n = Branch(*ref);
+        std::size_t m{};
+        while (m < n->prefix.size() && n->prefix[m] == leaf->bytes[depth + m]) {
+            ++m;
+        }
+        if (m < n->prefix.size()) {
+            // The key leaves the compressed path: split the prefix at the mismatch.
+            Inner4* parent = Make<Inner4>();
+            if (!parent) {
+                delete leaf;
+                return;
+            }
+            parent->prefix = n->prefix.substr(0, m);
+            unsigned char b = static_cast<unsigned char>(n->prefix[m]);
+            n->prefix.erase(0, m + 1);
+            Put(parent, b, *ref);
+            Put(parent, static_cast<unsigned char>(leaf->bytes[depth + m]), Tag(leaf));
+            *ref = Untag(parent);
+            ++size;
+            return;
+        }
+        depth += n->prefix.size();
+        unsigned char b = static_cast<unsigned char>(leaf->bytes[depth]);
+        if (Link* child = Find(n, b)) {
+            ref = child;
+            ++depth;
+        }
+        else {
+            if (Add(*ref, b, Tag(leaf))) {
+                ++size;
+            }
+            else {
+                delete leaf;
+            }
+            return;
+        }
+    }
+    *ref = Tag(leaf);
+    ++size;
+}
+
+template <typename K, class I>
+void RadixTree<K, I>::Delete(Node** n) noexcept {
+    if (n != nullptr) {
+        if (Node* np = *n) {
+            Link* ref = &root;
+            Link* parent{};
+            unsigned char b{};
+            std::size_t depth{};
+            while (*ref && !IsLeaf(*ref)) {
+                Inner* in = Branch(*ref);
+                if (np->bytes.compare(depth, in->prefix.size(), in->prefix) != 0) {
+                    return;
+                }
+                depth += in->prefix.size();
+                b = static_cast<unsigned char>(np->bytes[depth]);
+                Link* child = depth < np->bytes.size() ? Find(in, b) : nullptr;
+                if (!child) {
+                    return;
+                }
+                parent = ref;
+                ref = child;
+                ++depth;
+            }
+            if (!*ref || Leaf(*ref) != np) {
+                return; // Not a node of this tree.
+            }
+            if (parent) {
+                Remove(*parent, b);
+            }
+            else {
+                root = nullptr;
+            }
+            delete np;
+            --size;
+            *n = nullptr;
+        }
+    }
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::Search(K key) const {
+    std::string bytes = Encode(key);
+    Link l = root;
+    std::size_t depth{};
+    while (l && !IsLeaf(l)) {
+        Inner* n = Branch(l);
+        if (bytes.compare(depth, n->prefix.size(), n->prefix) != 0) {
+            return nullptr;
+        }
+        depth += n->prefix.size();
+        if (depth >= bytes.size()) {
+            return nullptr;
+        }
+        Link* child = Find(n, static_cast<unsigned char>(bytes[depth++]));
+        l = child ? *child : nullptr;
+    }
+    return l && Leaf(l)->bytes == bytes ? Leaf(l) : nullptr;
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::LowerBound(K key) const {
+    return root ? Ceiling(root, Encode(key), 0, false) : nullptr;
+}
+
+template <typename K, class I>
+template <class F>
+std::size_t RadixTree<K, I>::ForEachInRange(K lo, K hi, F visit) const {
+    std::size_t visited{};
+    std::string upper = Encode(hi);
+    for (Node* n = LowerBound(lo); n && n->bytes.compare(upper) <= 0; n = Successor(n)) {
+        ++visited;
+        if (!visit(n)) {
+            break;
+        }
+    }
+    return visited;
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::Allocate(K key, std::string bytes, I&& item) {
+    try {
+        return new Node{ key, std::move(bytes), std::forward<I>(item) };
+    }
+    catch (std::bad_alloc& e) {
+        std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+        return nullptr;
+    }
+}
+
+template <typename K, class I>
+template <class N>
+N* RadixTree<K, I>::Make() noexcept {
+    try {
+        return new N{};
+    }
+    catch (std::bad_alloc& e) {
+        std::cerr << "Node allocation failure on line " << __LINE__ - 3 << " of " << __FILE__ << "." << std::endl;
+        return nullptr;
+    }
+}
+
+template <typename K, class I>
+void RadixTree<K, I>::Free(Inner* n) noexcept {
+    switch (n->kind) {
+    case Kind::N4: delete static_cast<Inner4*>(n); break;
+    case Kind::N16: delete static_cast<Inner16*>(n); break;
+    case Kind::N48: delete static_cast<Inner48*>(n); break;
+    case Kind::N256: delete static_cast<Inner256*>(n); break;
+    }
+}
+
+template <typename K, class I>
+void RadixTree<K, I>::Release(Link l) noexcept {
+    if (!l) {
+        return;
+    }
+    if (IsLeaf(l)) {
+        delete Leaf(l);
+        return;
+    }
+    Inner* n = Branch(l);
+    ForEachChild(n, [](unsigned char, Link child) { Release(child); });
+    Free(n);
+}
+
+template <typename K, class I>
+std::size_t RadixTree<K, I>::Capacity(const Inner* n) {
+    switch (n->kind) {
+    case Kind::N4: return 4;
+    case Kind::N16: return 16;
+    case Kind::N48: return 48;
+    default: return 256;
+    }
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Link* RadixTree<K, I>::Find(Inner* n, unsigned char b) {
+    auto sorted = [b](auto* s) -> Link* {
+        for (std::size_t i = 0; i < s->count && s->keys[i] <= b; ++i) {
+            if (s->keys[i] == b) {
+                return &s->children[i];
+            }
+        }
+        return nullptr;
+    };
+    switch (n->kind) {
+    case Kind::N4: return sorted(static_cast<Inner4*>(n));
+    case Kind::N16: return sorted(static_cast<Inner16*>(n));
+    case Kind::N48: {
+        Inner48* s = static_cast<Inner48*>(n);
+        return s->index[b] ? &s->children[s->index[b] - 1] : nullptr;
+    }
+    default: {
+        Inner256* s = static_cast<Inner256*>(n);
+        return s->children[b] ? &s->children[b] : nullptr;
+    }
+    }
+}
+
+/**
+*   Put() and Take() add or remove one child of a node known to have room, or to hold it.
+*/
+template <typename K, class I>
+void RadixTree<K, I>::Put(Inner* n, unsigned char b, Link child) {
+    auto sorted = [b, child](auto* s) {
+        std::size_t i = s->count;
+        for (; i > 0 && s->keys[i - 1] > b; --i) {
+            s->keys[i] = s->keys[i - 1];
+            s->children[i] = s->children[i - 1];
+        }
+        s->keys[i] = b;
+        s->children[i] = child;
+    };
+    switch (n->kind) {
+    case Kind::N4: sorted(static_cast<Inner4*>(n)); break;
+    case Kind::N16: sorted(static_cast<Inner16*>(n)); break;
+    case Kind::N48: {
+        Inner48* s = static_cast<Inner48*>(n);
+        std::size_t slot{};
+        while (s->children[slot]) {
+            ++slot;
+        }
+        s->children[slot] = child;
+        s->index[b] = static_cast<unsigned char>(slot + 1);
+        break;
+    }
+    case Kind::N256: static_cast<Inner256*>(n)->children[b] = child; break;
+    }
+    ++n->count;
+}
+
+template <typename K, class I>
+void RadixTree<K, I>::Take(Inner* n, unsigned char b) {
+    auto sorted = [b](auto* s) {
+        std::size_t i{};
+        while (s->keys[i] != b) {
+            ++i;
+        }
+        for (; i + 1 < s->count; ++i) {
+            s->keys[i] = s->keys[i + 1];
+            s->children[i] = s->children[i + 1];
+        }
+    };
+    switch (n->kind) {
+    case Kind::N4: sorted(static_cast<Inner4*>(n)); break;
+    case Kind::N16: sorted(static_cast<Inner16*>(n)); break;
+    case Kind::N48: {
+        Inner48* s = static_cast<Inner48*>(n);
+        s->children[s->index[b] - 1] = nullptr;
+        s->index[b] = 0;
+        break;
+    }
+    case Kind::N256: static_cast<Inner256*>(n)->children[b] = nullptr; break;
+    }
+    --n->count;
+}
+
+template <typename K, class I>
+template <class F>
+void RadixTree<K, I>::ForEachChild(Inner* n, F f) {
+    auto sorted = [&f](auto* s) {
+        for (std::size_t i = 0; i < s->count; ++i) {
+            f(s->keys[i], s->children[i]);
+        }
+    };
+    switch (n->kind) {
+    case Kind::N4: sorted(static_cast<Inner4*>(n)); break;
+    case Kind::N16: sorted(static_cast<Inner16*>(n)); break;
+    case Kind::N48: {
+        Inner48* s = static_cast<Inner48*>(n);
+        for (std::size_t b = 0; b < 256; ++b) {
+            if (s->index[b]) {
+                f(static_cast<unsigned char>(b), s->children[s->index[b] - 1]);
+            }
+        }
+        break;
+    }
+    case Kind::N256: {
+        Inner256* s = static_cast<Inner256*>(n);
+        for (std::size_t b = 0; b < 256; ++b) {
+            if (s->children[b]) {
+                f(static_cast<unsigned char>(b), s->children[b]);
+            }
+        }
+        break;
+    }
+    }
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Link RadixTree<K, I>::First(Inner* n) {
+    Link* first = Find(n, 0);
+    return first ? *first : Above(n, 0);
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Link RadixTree<K, I>::Last(Inner* n) {
+    Link* last = Find(n, 255);
+    return last ? *last : Below(n, 255);
+}
+
+/**
+*   Above() and Below() return the nearest child strictly after or before byte 'b'.
+*/
+template <typename K, class I>
+typename RadixTree<K, I>::Link RadixTree<K, I>::Above(Inner* n, unsigned char b) {
+    auto sorted = [b](auto* s) -> Link {
+        for (std::size_t i = 0; i < s->count; ++i) {
+            if (s->keys[i] > b) {
+                return s->children[i];
+            }
+        }
+        return nullptr;
+    };
+    switch (n->kind) {
+    case Kind::N4: return sorted(static_cast<Inner4*>(n));
+    case Kind::N16: return sorted(static_cast<Inner16*>(n));
+    case Kind::N48: {
+        Inner48* s = static_cast<Inner48*>(n);
+        for (std::size_t c = b + 1; c < 256; ++c) {
+            if (s->index[c]) {
+                return s->children[s->index[c] - 1];
+            }
+        }
+        return nullptr;
+    }
+    default: {
+        Inner256* s = static_cast<Inner256*>(n);
+        for (std::size_t c = b + 1; c < 256; ++c) {
+            if (s->children[c]) {
+                return s->children[c];
+            }
+        }
+        return nullptr;
+    }
+    }
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Link RadixTree<K, I>::Below(Inner* n, unsigned char b) {
+    auto sorted = [b](auto* s) -> Link {
+        for (std::size_t i = s->count; i > 0; --i) {
+            if (s->keys[i - 1] < b) {
+                return s->children[i - 1];
+            }
+        }
+        return nullptr;
+    };
+    switch (n->kind) {
+    case Kind::N4: return sorted(static_cast<Inner4*>(n));
+    case Kind::N16: return sorted(static_cast<Inner16*>(n));
+    case Kind::N48: {
+        Inner48* s = static_cast<Inner48*>(n);
+        for (std::size_t c = b; c-- > 0;) {
+            if (s->index[c]) {
+                return s->children[s->index[c] - 1];
+            }
+        }
+        return nullptr;
+    }
+    default: {
+        Inner256* s = static_cast<Inner256*>(n);
+        for (std::size_t c = b; c-- > 0;) {
+            if (s->children[c]) {
+                return s->children[c];
+            }
+        }
+        return nullptr;
+    }
+    }
+}
+
+template <typename K, class I>
+bool RadixTree<K, I>::Add(Link& ref, unsigned char b, Link child) noexcept {
+    Inner* n = Branch(ref);
+    if (n->count == Capacity(n)) {
+        Inner* grown{};
+        switch (n->kind) {
+        case Kind::N4: grown = Resize<Inner16>(n); break;
+        case Kind::N16: grown = Resize<Inner48>(n); break;
+        default: grown = Resize<Inner256>(n); break;
+        }
+        if (!grown) {
+            return false;
+        }
+        ref = Untag(n = grown);
+    }
+    Put(n, b, child);
+    return true;
+}
+
+template <typename K, class I>
+void RadixTree<K, I>::Remove(Link& ref, unsigned char b) noexcept {
+    Inner* n = Branch(ref);
+    Take(n, b);
+    Inner* shrunk{};
+    switch (n->kind) {
+    case Kind::N4:
+        if (1 == n->count) {
+            // Collapse: the only child absorbs this node's prefix and byte.
+            Link child{};
+            unsigned char cb{};
+            ForEachChild(n, [&](unsigned char c, Link l) { cb = c; child = l; });
+            if (!IsLeaf(child)) {
+                std::string& prefix = Branch(child)->prefix;
+                prefix.insert(prefix.begin(), static_cast<char>(cb));
+                prefix.insert(0, n->prefix);
+            }
+            ref = child;
+            Free(n);
+        }
+        return;
+    case Kind::N16: shrunk = n->count <= 3 ? Resize<Inner4>(n) : nullptr; break;
+    case Kind::N48: shrunk = n->count <= 12 ? Resize<Inner16>(n) : nullptr; break;
+    case Kind::N256: shrunk = n->count <= 37 ? Resize<Inner48>(n) : nullptr; break;
+    }
+    if (shrunk) {
+        ref = Untag(shrunk);
+    }
+}
+
+/**
+*   Moves the prefix and children of 'n' into a new node of type N and frees 'n'.
+*   Returns nullptr, leaving 'n' untouched, if the new node cannot be allocated.
+*/
+template <typename K, class I>
+template <class N>
+typename RadixTree<K, I>::Inner* RadixTree<K, I>::Resize(Inner* n) noexcept {
+    N* r = Make<N>();
+    if (r) {
+        r->prefix.swap(n->prefix);
+        ForEachChild(n, [r](unsigned char b, Link child) { Put(r, b, child); });
+        Free(n);
+    }
+    return r;
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::Minimum(Link l) {
+    while (!IsLeaf(l)) {
+        l = First(Branch(l));
+    }
+    return Leaf(l);
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::Maximum(Link l) {
+    while (!IsLeaf(l)) {
+        l = Last(Branch(l));
+    }
+    return Leaf(l);
+}
+
+/**
+*   Ceiling() returns the first leaf below 'l' whose bytes are not less than 'b' (greater
+*   than, if 'strict'); Floor() the last leaf whose bytes are less than 'b'. Subtrees
+*   whose path already diverges from 'b' are resolved by their minimum or maximum.
+*/
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::Ceiling(Link l, const std::string& b, std::size_t depth, bool strict) {
+    if (IsLeaf(l)) {
+        int c = Leaf(l)->bytes.compare(b);
+        return (c > 0 || (!strict && 0 == c)) ? Leaf(l) : nullptr;
+    }
+    Inner* n = Branch(l);
+    for (char p : n->prefix) {
+        if (depth >= b.size()) {
+            return Minimum(l);
+        }
+        unsigned char pb = static_cast<unsigned char>(p);
+        unsigned char kb = static_cast<unsigned char>(b[depth++]);
+        if (pb != kb) {
+            return pb > kb ? Minimum(l) : nullptr;
+        }
+    }
+    if (depth >= b.size()) {
+        return Minimum(l);
+    }
+    unsigned char kb = static_cast<unsigned char>(b[depth]);
+    if (Link* child = Find(n, kb)) {
+        if (Node* found = Ceiling(*child, b, depth + 1, strict)) {
+            return found;
+        }
+    }
+    Link next = Above(n, kb);
+    return next ? Minimum(next) : nullptr;
+}
+
+template <typename K, class I>
+typename RadixTree<K, I>::Node* RadixTree<K, I>::Floor(Link l, const std::string& b, std::size_t depth) {
+    if (IsLeaf(l)) {
+        return Leaf(l)->bytes.compare(b) < 0 ? Leaf(l) : nullptr;
+    }
+    Inner* n = Branch(l);
+    for (char p : n->prefix) {
+        if (depth >= b.size()) {
+            return nullptr;
+        }
+        unsigned char pb = static_cast<unsigned char>(p);
+        unsigned char kb = static_cast<unsigned char>(b[depth++]);
+        if (pb != kb) {
+            return pb < kb ? Maximum(l) : nullptr;
+        }
+    }
+    if (depth >= b.size()) {
+        return nullptr;
+    }
+    unsigned char kb = static_cast<unsigned char>(b[depth]);
+    if (Link* child = Find(n, kb)) {
+        if (Node* found = Floor(*child, b, depth + 1)) {
+            return found;
+        }
+    }
+    Link prev = Below(n, kb);
+    return prev ? Maximum(prev) : nullptr;
+}
@@ -0,0 +1,340 @@
+#pragma once
+#include "Tree.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+/**
+*   Key-Range Sharded Tree
+*    Partitions keys across independent Tree shards, each guarded by its own mutex, so
+*    writers in different ranges proceed in parallel. Shard i holds the keys in
+*    (bounds[i - 1], bounds[i]]; the last shard is unbounded above. Point operations hold
+*    the routing table shared while they work on one shard. Once an Insert() or Delete()
+*    leaves a shard more than Skew times the size of a neighbour, the routing table is
+*    taken exclusively and that pair alone is evened out: the two shards are joined,
+*    walked from the nearer end to the new bound and split there. Rebalance() evens every
+*    pair in turn so that each shard holds an even share of the keys. Nodes are relinked,
+*    never reallocated, and a pair grows at most one level taller each time it is evened.
+*/
+template <typename K, class I, std::size_t Skew = 4>
+class ShardedTree {
+public:
+    using Node = typename Tree<K, I>::Node;
+
+    /**
+    * Cursor
+    *  Position in the merged key order across shards; null node once past the end.
+    *  Not safe against concurrent writers to the shard it points into.
+    */
+    struct Cursor {
+        std::size_t shard;
+        Node* node;
+    };
+
+    explicit ShardedTree(std::vector<K> upper);  // N - 1 ascending bounds for N shards.
+
+    /**
+    * Modifiers
+    *  Delete(K) removes one node with the given key; returns false if none exists.
+    */
+    void Insert(K k, I&& i);
+    bool Delete(K k);
+    void Rebalance();
+
+    /**
+    * Accessors
+    *  Search() copies the item out under the shard's lock.
+    */
+    std::optional<I> Search(K k) const;
+    std::size_t Size() const;
+    std::size_t Shards() const { return shards.size(); }
+    std::size_t Route(K k) const;   // Shard index for a key.
+    std::size_t Height() const;     // Height of the tallest shard.
+
+    Cursor Begin() const;
+    void Next(Cursor& c) const;
+    std::vector<std::pair<K, I>> Walk() const;
+
+private:
+    struct Shard {
+        mutable std::mutex lock;
+        Tree<K, I> tree;
+        std::atomic<std::size_t> size{};    // Read without the lock to spot skew.
+    };
+
+    std::size_t Locate(const K& k) const;
+    bool Lopsided(std::size_t i) const;     // Whether the pair (i, i + 1) is skewed.
+    std::size_t Skewed(std::size_t i) const;    // The more skewed pair holding shard i; bounds.size() if none.
+    void Relieve(std::size_t i);            // Evens the pairs skewed around shard i.
+    void Even(std::size_t i, std::size_t keep); // Moves bounds[i] so that shard i holds about 'keep' keys.
+
+    mutable std::shared_mutex routing;
+    std::vector<K> bounds;
+    std::vector<std::unique_ptr<Shard>> shards;
+};
+
+template <typename K, class I, std::size_t Skew>
+ShardedTree<K, I, Skew>::ShardedTree(std::vector<K> upper) : routing{}, bounds{ std::move(upper) }, shards{} {
+    std::sort(bounds.begin(), bounds.end());
+    for (std::size_t i = 0; i <= bounds.size(); ++i) {
+        shards.push_back(std::make_unique<Shard>());
+    }
+}
+
+template <typename K, class I, std::size_t Skew>
+void ShardedTree<K, I, Skew>::Insert(K key, I&& item) {
+    std::size_t i;
+    bool skewed{};
+    {
+        std::shared_lock<std::shared_mutex> r{ routing };
+        Shard& s = *shards[i = Locate(key)];
+        std::lock_guard<std::mutex> l{ s.lock };
+        if (s.tree.Insert(nullptr, key, std::forward<I>(item))) {
+            ++s.size;
+            skewed = Skewed(i) < bounds.size();
+        }
+    }
+    if (skewed) {
+        Relieve(i);
+    }
+}
+
+template <typename K, class I, std::size_t Skew>
+bool ShardedTree<K, I, Skew>::Delete(K key) {
+    std::size_t i;
+    bool skewed{};
+    {
+        std::shared_lock<std::shared_mutex> r{ routing };
+        Shard& s = *shards[i = Locate(key)];
+        std::lock_guard<std::mutex> l{ s.lock };
+        Node* n = s.tree.Search(key);
+        if (!n) {
+            return false;
+        }
+        s.tree.Delete(&n);
+        --s.size;
+        skewed = Skewed(i) < bounds.size();
+    }
+    if (skewed) {
+        Relieve(i);
+    }
+    return true;
+}
+
+template <typename K, class I, std::size_t Skew>
+std::optional<I> ShardedTree<K, I, Skew>::Search(K key) const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    const Shard& s = *shards[Locate(key)];
+    std::lock_guard<std::mutex> l{ s.lock };
+    if (Node* n = s.tree.Search(key)) {
+        return n->item;
+    }
+    return std::nullopt;
+}
+
+template <typename K, class I, std::size_t Skew>
+std::size_t ShardedTree<K, I, Skew>::Size() const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    std::size_t size{};
+    for (auto& s : shards) {
+        std::lock_guard<std::mutex> l{ s->lock };
+        size += s->size;
+    }
+    return size;
+}
+
+template <typename K, class I, std::size_t Skew>
+std::size_t ShardedTree<K, I, Skew>::Route(K key) const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    return Locate(key);
+}
+
+template <typename K, class I, std::size_t Skew>
+std::size_t ShardedTree<K, I, Skew>::Height() const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    std::size_t height{};
+    for (auto& s : shards) {
+        std::lock_guard<std::mutex> l{ s->lock };
+        height = std::max(height, s->tree.Height());
+    }
+    return height;
+}
+
+template <typename K, class I, std::size_t Skew>
+typename ShardedTree<K, I, Skew>::Cursor ShardedTree<K, I, Skew>::Begin() const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    for (std::size_t i = 0; i < shards.size(); ++i) {
+        std::lock_guard<std::mutex> l{ shards[i]->lock };
+        if (Node* n = shards[i]->tree.Minimum()) {
+            return Cursor{ i, n };
+        }
+    }
+    return Cursor{ shards.size(), nullptr };
+}
+
+/**
+*   Shards cover ascending disjoint ranges, so merging them is concatenation: once a
+*   shard is exhausted the cursor continues at the minimum of the next non-empty one.
+*/
+template <typename K, class I, std::size_t Skew>
+void ShardedTree<K, I, Skew>::Next(Cursor& c) const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    if (c.node) {
+        std::lock_guard<std::mutex> l{ shards[c.shard]->lock };
+        c.node = shards[c.shard]->tree.Successor(c.node);
+    }
+    while (!c.node && ++c.shard < shards.size()) {
+        std::lock_guard<std::mutex> l{ shards[c.shard]->lock };
+        c.node = shards[c.shard]->tree.Minimum();
+    }
+}
+
+template <typename K, class I, std::size_t Skew>
+std::vector<std::pair<K, I>> ShardedTree<K, I, Skew>::Walk() const {
+    std::shared_lock<std::shared_mutex> r{ routing };
+    std::vector<std::pair<K, I>> v;
+    for (auto& s : shards) {
+        std::lock_guard<std::mutex> l{ s->lock };
+        std::vector<std::pair<K, I>> w = s->tree.Walk();
+        v.insert(v.end(), w.begin(), w.end());
+    }
+    return v;
+}
+
+/**
+*   The keys crossing each bound are fixed by how far the shards up to it are from their
+*   even share. Pairs shedding keys rightward are evened left to right, then those
+*   shedding leftward right to left, so every donor already holds what it passes on.
+*/
+template <typename K, class I, std::size_t Skew>
+void ShardedTree<K, I, Skew>::Rebalance() {
+    std::unique_lock<std::shared_mutex> r{ routing };
+    std::size_t total{};
+    for (auto& s : shards) {
+        total += s->size;
+    }
+    std::size_t count = shards.size();
+    if (total < count) {
+        return; // Too few keys to give every shard one.
+    }
+    auto share = [total, count](std::size_t i) {   // Even share of shards 0..i.
+        return (i + 1) * (total / count) + std::min(i + 1, total % count);
+    };
+    std::size_t below{};    // Keys in shards 0..i.
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        std::size_t size = shards[i]->size;
+        below += size;
+        if (share(i) < below) {
+            Even(i, size - (below - share(i)));
+            below -= size - shards[i]->size;
+        }
+    }
+    std::size_t above{};    // Keys in shards past i.
+    for (std::size_t i = count - 1; i-- > 0;) {
+        std::size_t size = shards[i + 1]->size;
+        above += size;
+        if (total - above < share(i)) {
+            Even(i, shards[i]->size + (share(i) - (total - above)));
+            above -= size - shards[i + 1]->size;
+        }
+    }
+}
+
+/**
+*   Skewed while the larger side exceeds Skew times the smaller one, plus one so that
+*   nearly empty pairs are left alone.
+*/
+template <typename K, class I, std::size_t Skew>
+bool ShardedTree<K, I, Skew>::Lopsided(std::size_t i) const {
+    std::size_t a = shards[i]->size;
+    std::size_t b = shards[i + 1]->size;
+    return Skew * (std::min(a, b) + 1) < std::max(a, b);
+}
+
+template <typename K, class I, std::size_t Skew>
+std::size_t ShardedTree<K, I, Skew>::Skewed(std::size_t i) const {
+    std::size_t pair = bounds.size();
+    std::size_t gap{};
+    for (std::size_t p = i ? i - 1 : i; p <= i && p < bounds.size(); ++p) {
+        std::size_t a = shards[p]->size;
+        std::size_t b = shards[p + 1]->size;
+        if (Lopsided(p) && gap < std::max(a, b) - std::min(a, b)) {
+            gap = std::max(a, b) - std::min(a, b);
+            pair = p;
+        }
+    }
+    return pair;
+}
+
+/**
+*   Evening a pair changes both of its shards, so the pairs on either side are checked
+*   in turn, outward, until one is not skewed.
+*/
+template <typename K, class I, std::size_t Skew>
+void ShardedTree<K, I, Skew>::Relieve(std::size_t i) {
+    std::unique_lock<std::shared_mutex> r{ routing };
+    std::size_t pair = Skewed(i);
+    if (pair == bounds.size()) {
+        return; // Already evened by another writer.
+    }
+    auto even = [this](std::size_t p) { Even(p, (shards[p]->size + shards[p + 1]->size) / 2); };
+    even(pair);
+    for (std::size_t p = pair; p-- > 0 && Lopsided(p);) {
+        even(p);
+    }
+    for (std::size_t p = pair + 1; p < bounds.size() && Lopsided(p); ++p) {
+        even(p);
+    }
+}
+
+/**
+*   Joins shard i + 1 into shard i and walks from whichever end is nearer to the node
+*   that becomes the last of shard i, extended over equal keys so that they stay
+*   together, then splits there. Shard i may therefore end slightly over 'keep'. The
+*   routing table must be held exclusively.
+*/
+template <typename K, class I, std::size_t Skew>
+void ShardedTree<K, I, Skew>::Even(std::size_t i, std::size_t keep) {
+    Shard& a = *shards[i];
+    Shard& b = *shards[i + 1];
+    std::size_t pair = a.size + b.size;
+    keep = std::min(keep, pair);
+    if (keep == a.size || (0 == keep && 0 == i)) {
+        return; // Nothing moves, or shard 0 would need a bound below every key.
+    }
+    a.tree.Join(b.tree);
+    K bound = 0 == keep ? bounds[i - 1] : bounds[i];
+    std::size_t kept = keep;
+    if (0 < keep) {
+        Node* n{};
+        if (keep <= pair - keep) {
+            n = a.tree.Minimum();
+            for (std::size_t c = 1; c < keep; ++c) {
+                n = a.tree.Successor(n);
+            }
+        }
+        else {
+            n = a.tree.Maximum();
+            for (std::size_t c = keep; c < pair; ++c) {
+                n = a.tree.Predecessor(n);
+            }
+        }
+        bound = n->key;
+        for (n = a.tree.Successor(n); n && !(bound < n->key); n = a.tree.Successor(n)) {
+            ++kept;
+        }
+    }
+    a.tree.Split(bound, b.tree);
+    bounds[i] = bound;
+    a.size = kept;
+    b.size = pair - kept;
+}
+
+template <typename K, class I, std::size_t Skew>
+std::size_t ShardedTree<K, I, Skew>::Locate(const K& key) const {
+    return std::lower_bound(bounds.begin(), bounds.end(), key) - bounds.begin();
+}
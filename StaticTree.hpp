@@ -0,0 +1,153 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+*   Static Ordered Map
+*    Built entirely at compile time from a fixed set of entries, which are sorted and
+*    laid out in breadth-first (Eytzinger) order: the children of slot i sit at 2i and
+*    2i + 1, so a descent needs no links and touches memory front to back. Search()
+*    computes each next slot arithmetically from the comparison result, with no
+*    branch on it. K and I must be literal types; Node is a plain aggregate without the
+*    BaseNode vtable. Declare the tree constexpr to make lookups on constant keys fold.
+*/
+template <typename K, class I, std::size_t N>
+class StaticTree {
+    static_assert(N > 0, "StaticTree requires at least one entry.");
+public:
+    struct Node {
+        K key;
+        I item;
+    };
+
+    constexpr StaticTree(const Node (&entries)[N]);
+
+    /**
+    * Accessors
+    *  Return nullptr if the requested item does not exist.
+    */
+    constexpr const Node* operator[](const K& k) const { return Search(k); }
+
+    constexpr const Node* Search(const K& k) const;
+    constexpr const Node* LowerBound(const K& k) const;   // First node whose key is not less than k.
+    constexpr const Node* Minimum() const { return &nodes[Leftmost(1)]; }
+    constexpr const Node* Maximum() const { return &nodes[Rightmost(1)]; }
+    constexpr const Node* Predecessor(const Node* n) const;
+    constexpr const Node* Successor(const Node* n) const;
+    constexpr std::size_t Size() const { return N; }
+
+    std::vector<std::pair<K, I>> Walk() const;
+
+private:
+    constexpr std::size_t Place(const Node (&sorted)[N], std::size_t next, std::size_t slot);
+    static constexpr std::size_t Leftmost(std::size_t slot);
+    static constexpr std::size_t Rightmost(std::size_t slot);
+    constexpr const Node* At(std::size_t slot) const { return slot ? &nodes[slot] : nullptr; }
+
+    Node nodes[N + 1];  // Slot 0 is unused so that the root sits at 1.
+};
+
+template <typename K, class I, std::size_t N>
+constexpr StaticTree<K, I, N>::StaticTree(const Node (&entries)[N]) : nodes{} {
+    Node sorted[N]{};
+    for (std::size_t i = 0; i < N; ++i) {   // Insertion sort; stable for equal keys.
+        std::size_t j = i;
+        for (; j > 0 && entries[i].key < sorted[j - 1].key; --j) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = entries[i];
+    }
+    Place(sorted, 0, 1);
+}
+
+template <typename K, class I, std::size_t N>
+std::vector<std::pair<K, I>> StaticTree<K, I, N>::Walk() const {
+    std::vector<std::pair<K, I>> v;
+    for (const Node* n = Minimum(); n; n = Successor(n)) {
+        v.emplace_back(n->key, n->item);
+    }
+    return v;
+}
+
+template <typename K, class I, std::size_t N>
+constexpr const typename StaticTree<K, I, N>::Node* StaticTree<K, I, N>::Search(const K& key) const {
+    const Node* n = LowerBound(key);
+    return (n && !(key < n->key)) ? n : nullptr;
+}
+
+/**
+*   Descends to a leaf appending one bit per comparison; the slot where the path last
+*   turned left holds the answer and is recovered by dropping the trailing right turns.
+*/
+template <typename K, class I, std::size_t N>
+constexpr const typename StaticTree<K, I, N>::Node* StaticTree<K, I, N>::LowerBound(const K& key) const {
+    std::size_t slot = 1;
+    while (slot <= N) {
+        slot = 2 * slot + static_cast<std::size_t>(nodes[slot].key < key);
+    }
+    while (slot & 1) {
+        slot >>= 1;
+    }
+    return At(slot >> 1);
+}
+
+template <typename K, class I, std::size_t N>
+constexpr const typename StaticTree<K, I, N>::Node* StaticTree<K, I, N>::Predecessor(const Node* n) const {
+    if (!n) {
+        return nullptr;
+    }
+    std::size_t slot = static_cast<std::size_t>(n - nodes);
+    if (2 * slot <= N) {
+        return &nodes[Rightmost(2 * slot)];
+    }
+    while (slot > 1 && !(slot & 1)) {   // Climbs while a left child.
+        slot >>= 1;
+    }
+    return At(slot >> 1);
+}
+
+template <typename K, class I, std::size_t N>
+constexpr const typename StaticTree<K, I, N>::Node* StaticTree<K, I, N>::Successor(const Node* n) const {
+    if (!n) {
+        return nullptr;
+    }
+    std::size_t slot = static_cast<std::size_t>(n - nodes);
+    if (2 * slot + 1 <= N) {
+        return &nodes[Leftmost(2 * slot + 1)];
+    }
+    while (slot & 1) {                  // Climbs while a right child; the root ends at 0.
+        slot >>= 1;
+    }
+    return At(slot >> 1);
+}
+
+/**
+*   Fills slots in order of an in-order walk, so ascending entries land in search order.
+*   Returns the index of the next entry to place.
+*/
+template <typename K, class I, std::size_t N>
+constexpr std::size_t StaticTree<K, I, N>::Place(const Node (&sorted)[N], std::size_t next, std::size_t slot) {
+    if (slot <= N) {
+        next = Place(sorted, next, 2 * slot);
+        nodes[slot] = sorted[next++];
+        next = Place(sorted, next, 2 * slot + 1);
+    }
+    return next;
+}
+
+template <typename K, class I, std::size_t N>
+constexpr std::size_t StaticTree<K, I, N>::Leftmost(std::size_t slot) {
+    while (2 * slot <= N) {
+        slot = 2 * slot;
+    }
+    return slot;
+}
+
+template <typename K, class I, std::size_t N>
+constexpr std::size_t StaticTree<K, I, N>::Rightmost(std::size_t slot) {
+    while (2 * slot + 1 <= N) {
+        slot = 2 * slot + 1;
+    }
+    return slot;
+}
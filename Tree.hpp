@@ -1,11 +1,25 @@
 #pragma once
 #include "Node.hpp"
+#include <algorithm>
 #include <vector>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif
+
+/**
+*   Access policy
+*    Static leaves the shape alone on lookups. Splay rotates each node found by a
+*    non-const Search(), and each inserted node, up to the root so frequently used keys
+*    stay shallow. SemiSplay splays inserted nodes but only semi-splays lookups, roughly
+*    halving the found node's depth with fewer rotations, which limits write traffic on
+*    read-mostly workloads. Searches through a const Tree never restructure it.
+*/
+enum class Access { Static, Splay, SemiSplay };
 
 /**
 *   Unbalanced Binary Tree
 */
-template <typename K, class I>
+template <typename K, class I, Access A = Access::Static>
 class Tree {
 public:
     struct Node : BaseNode<I> {
@@ -18,6 +32,12 @@ public:
         friend class Tree;
     };
     
+    /**
+    * Owning handle to a node detached from any tree; deletes the node unless released.
+    */
+    template <typename> using Held = Node;
+    using Handle = HNode<Held, I>;
+
     Tree() : root{} {};
     Tree(Tree&& t) noexcept;
     ~Tree();
@@ -26,7 +46,42 @@ public:
     * Modifiers
     */
     void Insert(K k, I&& i);
+    Node* Insert(Node* hint, K k, I&& i);   // Starts from a node near k; see FingerSearch(). Returns the new node.
     void Delete(Node** n) noexcept;
+
+    /**
+    * Node Transfer
+    *  Extract() unlinks a node without freeing it, nulling the caller's pointer; the key
+    *  may then be changed through the handle. Insert() links a handle's node into this
+    *  tree, taking ownership. Neither allocates, copies, nor destroys the item.
+    */
+    Handle Extract(Node** n) noexcept;
+    void Insert(Handle&& h) noexcept;
+
+    /**
+    * Split & Join
+    *  Split() moves every node whose key is greater than k into the empty tree 't'. Join()
+    *  takes every node of 't', whose keys must not be less than any key here. Both relink
+    *  along one path each, so neither tree grows more than one level taller.
+    */
+    void Split(K k, Tree& t) noexcept;
+    void Join(Tree& t) noexcept;
+    std::size_t EraseRange(K lo, K hi) noexcept;  // Removes keys in [lo, hi]; returns the count.
+
+    /**
+    * Batched Update
+    *  Apply() takes 'count' updates sorted by key, equal keys in the order issued, and
+    *  pushes them down from the root in one pass: the batch is split around each node's
+    *  key, so no node is visited twice, and whatever reaches an empty link is built there
+    *  middle key first. An update that does not insert deletes one node with its key, if
+    *  any. Items are moved out of the updates.
+    */
+    struct Update {
+        K key;
+        bool insert;
+        I item;
+    };
+    void Apply(Update* u, std::size_t count);
     
     /**
     * Accessors
@@ -35,11 +90,39 @@ public:
     Node* operator[](K k) { return Search(k); }
     
     Node* Search(K k, Node* n = nullptr) const;
+    Node* Search(K k, Node* n = nullptr);   // Restructures around the found node per Access.
     Node* Minimum(Node* n = nullptr) const;
     Node* Maximum(Node* n = nullptr) const;
     Node* Predecessor(Node* n) const;
     Node* Successor(Node* n) const;
+    Node* LowerBound(K k) const;    // First node whose key is not less than k.
+
+    /**
+    * Finger Search
+    *  Starts from 'finger' instead of the root, climbing parent links only until an
+    *  ancestor's subtree must contain k, then descending. Lookups near the previous
+    *  result cost the climb and descent over that short distance rather than the full
+    *  depth. A null finger searches from the root.
+    */
+    Node* FingerSearch(Node* finger, K k) const;
+
+    /**
+    * Range Scan
+    *  Calls visit(Node*) in key order for each node whose key lies in [lo, hi], stopping
+    *  early once visit returns false. Returns the number of nodes visited.
+    */
+    template <class F>
+    std::size_t ForEachInRange(K lo, K hi, F visit) const;
+
+    /**
+    * Batched Search
+    *  Looks up 'count' keys, storing each result in the matching slot of 'found'.
+    *  Descents are interleaved in groups, one level at a time, prefetching each
+    *  next node so that the cache misses of independent lookups overlap.
+    */
+    void SearchBatch(const K* keys, Node** found, std::size_t count) const;
     
+    std::size_t Height() const;     // Nodes on the longest root-to-leaf path; 0 if empty.
     std::vector<std::pair<K, I>> Walk() const;
 
 private:
@@ -47,25 +130,32 @@ private:
     void DeallocateTree(Node** n) noexcept;
     void Clone(Node* n);
     void Transplant(Node* m, Node* n);  // Establishes mutual parent-child relationship; supports Insert().
+    Node* Climb(Node* n, const K& key) const;  // Lowest ancestor of n whose subtree may hold key.
+    void Link(Node* hint, Node* insertion) noexcept;    // Attaches a detached node below its position.
+    void Detach(Node* n) noexcept;                      // Unlinks a node, keeping its subtrees in place.
+    void Rotate(Node* n) noexcept;                      // Lifts n above its parent.
+    void Splay(Node* n) noexcept;
+    void SemiSplay(Node* n) noexcept;
+    static void Prefetch(const Node* n) noexcept;
+    void Cut(const K& key, bool inclusive, Tree& t) noexcept;   // Split(), also moving keys equal to key if inclusive.
+    static void Release(Node* n, std::size_t& erased) noexcept;   // Frees a subtree without recursing.
+    Node* Build(Update* u, std::size_t lo, std::size_t hi, Node* parent);   // Links u[lo, hi) middle first; supports Apply().
     Node* root;
 };
 
-template <typename K, typename I>
-Tree<K, I>::Tree(Tree&& t) noexcept {
+template <typename K, class I, Access A>
+Tree<K, I, A>::Tree(Tree&& t) noexcept {
     Clone(t.root);
     t.~Tree();
 }
 
-template <typename K, class I>
-Tree<K, I>::~Tree() {
-    if (Node* min = Minimum(root)) { // Deletes by walking up the tree.
-        DeallocateTree(&min);
-    }
-    root = nullptr;
+template <typename K, class I, Access A>
+Tree<K, I, A>::~Tree() {
+    DeallocateTree(&root);
 }
 
-template <typename K, class I>
-std::vector<std::pair<K, I>> Tree<K, I>::Walk() const {
+template <typename K, class I, Access A>
+std::vector<std::pair<K, I>> Tree<K, I, A>::Walk() const {
     std::vector<std::pair<K, I>> v;
     for (Node* n = Minimum(root); n; n = Successor(n)) {
         v.emplace_back(n->key, n->item);
@@ -73,64 +163,298 @@ std::vector<std::pair<K, I>> Tree<K, I>::Walk() const {
     return v;
 }
 
-template <typename K, class I>
-void Tree<K, I>::Insert(K key, I&& item) {
-    if (Node* insertion = Allocate(key, std::forward<I>(item))) {
-        if (Node* m = root) {
-            Node* n = m;
-            while (n) {
-                m = n;
-                if (insertion->key < n->key) {
-                    n = n->left;
-                }
-                else {
-                    n = n->right;
-                }
-            }
-            if (insertion->key < m->key) {
-                m->left = insertion;
-                m->left->parent = m;
+/**
+*   Counts levels breadth-first, so degenerate trees cost no recursion.
+*/
+template <typename K, class I, Access A>
+std::size_t Tree<K, I, A>::Height() const {
+    std::size_t height{};
+    std::vector<Node*> level;
+    if (root) {
+        level.push_back(root);
+    }
+    for (std::vector<Node*> next; !level.empty(); level.swap(next), next.clear()) {
+        for (Node* n : level) {
+            if (n->left) {
+                next.push_back(n->left);
             }
-            else {
-                m->right = insertion;
-                m->right->parent = m;
+            if (n->right) {
+                next.push_back(n->right);
             }
         }
-        else {
-            root = insertion;
+        ++height;
+    }
+    return height;
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Insert(K key, I&& item) {
+    Insert(nullptr, key, std::forward<I>(item));
+}
+
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Insert(Node* hint, K key, I&& item) {
+    Node* insertion = Allocate(key, std::forward<I>(item));
+    if (insertion) {
+        Link(hint, insertion);
+        if constexpr (Access::Static != A) {
+            Splay(insertion);
+        }
+    }
+    return insertion;
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Insert(Handle&& h) noexcept {
+    if (Node* insertion = h.Release()) {
+        Link(nullptr, insertion);
+        if constexpr (Access::Static != A) {
+            Splay(insertion);
         }
     }
 }
 
-template <typename K, class I>
-void Tree<K, I>::Delete(Node** n) noexcept {
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Delete(Node** n) noexcept {
     if (n != nullptr) {
         if (Node* np = *n) {
-            if (nullptr == np->left) {
-                Transplant(np, np->right); // Handles parent-child references.
+            Detach(np);
+            delete* n;
+            *n = nullptr;
+        }
+    }
+}
+
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Handle Tree<K, I, A>::Extract(Node** n) noexcept {
+    Node* np{};
+    if (n != nullptr) {
+        if ((np = *n)) {
+            Detach(np);
+            np->parent = np->left = np->right = nullptr;
+            *n = nullptr;
+        }
+    }
+    return Handle{ np };
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Split(K key, Tree& t) noexcept {
+    Cut(key, false, t);
+}
+
+/**
+*   Descends along the search path for k, hooking each node onto the side it belongs to:
+*   a node kept here brings its left subtree and waits for a right child, a node moved
+*   brings its right subtree and waits for a left child.
+*/
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Cut(const K& key, bool inclusive, Tree& t) noexcept {
+    Node* kept{};
+    Node* moved{};
+    Node** keptHook = &root;
+    Node** movedHook = &t.root;
+    for (Node* n = root; n;) {
+        if (key < n->key || (inclusive && !(n->key < key))) {
+            *movedHook = n;
+            n->parent = moved;
+            moved = n;
+            movedHook = &n->left;
+            n = n->left;
+        }
+        else {
+            *keptHook = n;
+            n->parent = kept;
+            kept = n;
+            keptHook = &n->right;
+            n = n->right;
+        }
+    }
+    *keptHook = nullptr;
+    *movedHook = nullptr;
+}
+
+/**
+*   The maximum here becomes the root, with the rest of this tree on its left and 't' on
+*   its right.
+*/
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Join(Tree& t) noexcept {
+    if (this == &t || !t.root) {
+        return;
+    }
+    if (Node* max = Maximum(root)) {
+        Detach(max);    // Leaves the rest of this tree at root.
+        max->left = root;
+        max->right = t.root;
+        max->parent = nullptr;
+        if (max->left) {
+            max->left->parent = max;
+        }
+        max->right->parent = max;
+        root = max;
+    }
+    else {
+        root = t.root;
+    }
+    t.root = nullptr;
+}
+
+/**
+*   Cuts the band [lo, hi] out along its two boundary paths, frees it, and joins what
+*   remains on either side; no step recurses, so degenerate trees are safe.
+*/
+template <typename K, class I, Access A>
+std::size_t Tree<K, I, A>::EraseRange(K lo, K hi) noexcept {
+    std::size_t erased{};
+    if (!(hi < lo)) {
+        Tree band;
+        Tree upper;
+        Cut(lo, true, band);
+        band.Cut(hi, false, upper);
+        Release(band.root, erased);
+        band.root = nullptr;
+        Join(upper);
+    }
+    return erased;
+}
+
+/**
+*   Each pending range waits below a link. At a node the range is split around its key;
+*   the run on that key is settled in issue order, a delete taking the node first and then
+*   the oldest insert still standing. Deletes that found nothing, then the surviving
+*   inserts, are packed against the greater keys and sent right, where Link() puts equal
+*   keys. Deleted nodes are detached after the pass so the links followed stay put; ranges
+*   are kept on a stack, so degenerate trees cost no recursion.
+*/
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Apply(Update* u, std::size_t count) {
+    struct Range {
+        Node* parent;
+        Node** link;
+        std::size_t lo;
+        std::size_t hi;
+    };
+    auto move = [u](std::size_t from, std::size_t to) {
+        if (from != to) {
+            u[to] = std::move(u[from]);
+        }
+    };
+    std::vector<Node*> doomed;
+    std::vector<Range> pending{ Range{ nullptr, &root, 0, count } };
+    while (!pending.empty()) {
+        Range r = pending.back();
+        pending.pop_back();
+        for (Node* n; r.lo < r.hi && (n = *r.link);) {  // Only a second nonempty side waits on the stack.
+            std::size_t a = std::lower_bound(u + r.lo, u + r.hi, n->key,
+                [](const Update& m, const K& k) { return m.key < k; }) - u;
+            std::size_t w = a;
+            if (a < r.hi && !(n->key < u[a].key)) {
+                std::size_t b = std::upper_bound(u + a, u + r.hi, n->key,
+                    [](const K& k, const Update& m) { return k < m.key; }) - u;
+                bool alive = true;
+                std::size_t fresh{};    // Inserts of the run not yet deleted; always the latest ones.
+                std::size_t missed = a; // Deletes that found nothing, packed from 'a'.
+                for (std::size_t i = a; i < b; ++i) {
+                    if (u[i].insert) {
+                        ++fresh;
+                    }
+                    else if (alive) {
+                        alive = false;
+                        doomed.push_back(n);
+                    }
+                    else if (fresh) {
+                        --fresh;
+                    }
+                    else {
+                        move(i, missed++);
+                    }
+                }
+                w = b;
+                for (std::size_t i = b, kept = 0; kept < fresh;) {
+                    if (u[--i].insert) {
+                        move(i, --w);
+                        ++kept;
+                    }
+                }
+                for (std::size_t i = missed; a < i;) {
+                    move(--i, --w);
+                }
             }
-            else if (nullptr == np->right) {
-                Transplant(np, np->left);
+            Range left{ n, &n->left, r.lo, a };
+            r = Range{ n, &n->right, w, r.hi };
+            if (left.lo < left.hi) {
+                if (r.lo < r.hi) {
+                    pending.push_back(left);
+                }
+                else {
+                    r = left;
+                }
             }
-            else {
-                Node* min = Minimum(np->right);
-                if (np != min->parent) {
-                    Transplant(min, min->right);
-                    min->right = np->right;
-                    min->right->parent = min;
+        }
+        if (r.lo < r.hi) {
+            std::size_t w = r.lo;   // Surviving inserts, packed; deletes here find nothing.
+            for (std::size_t i = r.lo, j; i < r.hi; i = j) {
+                std::size_t inserts{};
+                std::size_t fresh{};
+                for (j = i; j < r.hi && !(u[i].key < u[j].key); ++j) {
+                    if (u[j].insert) {
+                        ++inserts;
+                        ++fresh;
+                    }
+                    else if (fresh) {
+                        --fresh;
+                    }
+                }
+                for (std::size_t k = i; k < j; ++k) {
+                    if (u[k].insert && inserts-- <= fresh) {
+                        move(k, w++);
+                    }
                 }
-                Transplant(np, min);
-                min->left = np->left;
-                min->left->parent = min;
             }
-            delete* n;
-            *n = nullptr;
+            *r.link = Build(u, r.lo, w, r.parent);
+        }
+    }
+    for (Node* n : doomed) {
+        Delete(&n);
+    }
+}
+
+/**
+*   Equal keys go right, as in Link(), so the middle is moved to the first of its run. A
+*   failed allocation drops that item and hangs the greater keys off the lesser ones.
+*/
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Build(Update* u, std::size_t lo, std::size_t hi, Node* parent) {
+    if (hi <= lo) {
+        return nullptr;
+    }
+    std::size_t mid = lo + (hi - lo) / 2;
+    while (lo < mid && !(u[mid - 1].key < u[mid].key)) {
+        --mid;
+    }
+    Node* n = Allocate(u[mid].key, std::move(u[mid].item));
+    if (n) {
+        n->parent = parent;
+        n->left = Build(u, lo, mid, n);
+        n->right = Build(u, mid + 1, hi, n);
+        return n;
+    }
+    Node* lesser = Build(u, lo, mid, parent);
+    Node* greater = Build(u, mid + 1, hi, lesser ? nullptr : parent);
+    if (lesser) {
+        Node* max = Maximum(lesser);
+        max->right = greater;
+        if (greater) {
+            greater->parent = max;
         }
+        return lesser;
     }
+    return greater;
 }
 
-template <typename K, class I>
-typename Tree<K, I>::Node* Tree<K, I>::Search(K key, Node* n) const {
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Search(K key, Node* n) const {
     if (n || root) {
         if (!n && root) {
             n = root;
@@ -148,8 +472,95 @@ typename Tree<K, I>::Node* Tree<K, I>::Search(K key, Node* n) const {
     return n;
 }
 
-template <typename K, class I>
-typename Tree<K, I>::Node* Tree<K, I>::Minimum(Node* n) const {
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Search(K key, Node* n) {
+    Node* found = static_cast<const Tree&>(*this).Search(key, n);
+    if (found) {
+        if constexpr (Access::Splay == A) {
+            Splay(found);
+        }
+        else if constexpr (Access::SemiSplay == A) {
+            SemiSplay(found);
+        }
+    }
+    return found;
+}
+
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::LowerBound(K key) const {
+    Node* found{};
+    for (Node* n = root; n;) {
+        if (n->key < key) {
+            n = n->right;
+        }
+        else {
+            found = n;
+            n = n->left;
+        }
+    }
+    return found;
+}
+
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::FingerSearch(Node* finger, K key) const {
+    if (finger && key == finger->key) {
+        return finger;
+    }
+    return Search(key, finger ? Climb(finger, key) : nullptr);
+}
+
+template <typename K, class I, Access A>
+template <class F>
+std::size_t Tree<K, I, A>::ForEachInRange(K lo, K hi, F visit) const {
+    std::size_t visited{};
+    for (Node* n = LowerBound(lo); n && !(hi < n->key); n = Successor(n)) {
+        ++visited;
+        if (!visit(n)) {
+            break;
+        }
+    }
+    return visited;
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::SearchBatch(const K* keys, Node** found, std::size_t count) const {
+    constexpr std::size_t Group{ 16 };  // Descents in flight; enough to cover memory latency.
+    Node* cursors[Group];
+    for (std::size_t base = 0; base < count; base += Group) {
+        std::size_t size = std::min(Group, count - base);
+        for (std::size_t i = 0; i < size; ++i) {
+            cursors[i] = root;
+            found[base + i] = nullptr;
+        }
+        Prefetch(root);
+        for (std::size_t active = size; active;) {
+            active = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                if (Node* n = cursors[i]) {
+                    const K& key = keys[base + i];
+                    if (n->key < key) {
+                        n = n->right;
+                    }
+                    else if (key < n->key) {
+                        n = n->left;
+                    }
+                    else {
+                        found[base + i] = n;
+                        n = nullptr;
+                    }
+                    if (n) {
+                        Prefetch(n);
+                        ++active;
+                    }
+                    cursors[i] = n;
+                }
+            }
+        }
+    }
+}
+
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Minimum(Node* n) const {
     if (n || root) {
         if (!n) {
             n = root;
@@ -161,8 +572,8 @@ typename Tree<K, I>::Node* Tree<K, I>::Minimum(Node* n) const {
     return n;
 }
 
-template <typename K, class I>
-typename Tree<K, I>::Node* Tree<K, I>::Maximum(Node* n) const {
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Maximum(Node* n) const {
     if (n || root) {
         if (!n) {
             n = root;
@@ -174,8 +585,8 @@ typename Tree<K, I>::Node* Tree<K, I>::Maximum(Node* n) const {
     return n;
 }
 
-template <typename K, class I>
-typename Tree<K, I>::Node* Tree<K, I>::Predecessor(Node* found) const {
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Predecessor(Node* found) const {
     if (Node* n = found) {
         if (n->left) {
             found = Maximum(n->left);
@@ -193,8 +604,8 @@ typename Tree<K, I>::Node* Tree<K, I>::Predecessor(Node* found) const {
     return found;
 }
 
-template <typename K, class I>
-typename Tree<K, I>::Node* Tree<K, I>::Successor(Node* found) const {
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Successor(Node* found) const {
     if (Node* n = found) {
         if (n->right) {
             found = Minimum(n->right);
@@ -212,8 +623,8 @@ typename Tree<K, I>::Node* Tree<K, I>::Successor(Node* found) const {
     return found;
 }
 
-template <typename K, class I>
-typename Tree<K, I>::Node* Tree<K, I>::Allocate(K key, I&& item) {
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Allocate(K key, I&& item) {
     try {
         return new Node{ key, std::forward<I>(item) };
     }
@@ -223,17 +634,15 @@ typename Tree<K, I>::Node* Tree<K, I>::Allocate(K key, I&& item) {
     }
 }
 
-template <typename K, typename I>
-void Tree<K, I>::DeallocateTree(Node** n) noexcept {
-    if (Node* m = *n; m = Successor(m)) {
-        DeallocateTree(&m);
-    }
-    delete* n;
+template <typename K, class I, Access A>
+void Tree<K, I, A>::DeallocateTree(Node** n) noexcept {
+    std::size_t erased{};
+    Release(*n, erased);
     *n = nullptr;
 }
 
-template <typename K, typename I>
-void Tree<K, I>::Clone(Node* n) {
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Clone(Node* n) {
     if (n) {
         Insert(n->key, std::move(n->item));
         Clone(n->left);
@@ -241,8 +650,162 @@ void Tree<K, I>::Clone(Node* n) {
     }
 }
 
-template <typename K, class I>
-void Tree<K, I>::Transplant(Node* m, Node* n) { 
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Release(Node* n, std::size_t& erased) noexcept {
+    while (n) {
+        if (Node* l = n->left) {    // Rotates left children up until n has none.
+            n->left = l->right;
+            l->right = n;
+            n = l;
+        }
+        else {
+            Node* r = n->right;
+            delete n;
+            ++erased;
+            n = r;
+        }
+    }
+}
+
+/**
+*   The subtree of 'n' already bounds 'key' on the side facing the original node, so
+*   only the opposite bound matters. Only ancestors entered from that side set it; links
+*   from the other side leave it unchanged and are climbed without moving the result.
+*   Climbing stops at the first such ancestor whose key admits 'key', returning the last
+*   one that did not, or 'n' itself if there was none; on a spine that is 'n'.
+*/
+template <typename K, class I, Access A>
+typename Tree<K, I, A>::Node* Tree<K, I, A>::Climb(Node* n, const K& key) const {
+    Node* start = n;
+    bool below = key < n->key;
+    for (; n->parent; n = n->parent) {
+        Node* p = n->parent;
+        if (below ? n == p->right : n == p->left) {
+            if (below ? p->key < key : key < p->key) {
+                break;
+            }
+            start = p;
+        }
+    }
+    return start;
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Prefetch(const Node* n) noexcept {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    _mm_prefetch(reinterpret_cast<const char*>(n), _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(n);
+#else
+    (void)n;
+#endif
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Link(Node* hint, Node* insertion) noexcept {
+    if (Node* m = hint ? Climb(hint, insertion->key) : root) {
+        Node* n = m;
+        while (n) {
+            m = n;
+            if (insertion->key < n->key) {
+                n = n->left;
+            }
+            else {
+                n = n->right;
+            }
+        }
+        if (insertion->key < m->key) {
+            m->left = insertion;
+            m->left->parent = m;
+        }
+        else {
+            m->right = insertion;
+            m->right->parent = m;
+        }
+    }
+    else {
+        root = insertion;
+    }
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Detach(Node* np) noexcept {
+    if (nullptr == np->left) {
+        Transplant(np, np->right); // Handles parent-child references.
+    }
+    else if (nullptr == np->right) {
+        Transplant(np, np->left);
+    }
+    else {
+        Node* min = Minimum(np->right);
+        if (np != min->parent) {
+            Transplant(min, min->right);
+            min->right = np->right;
+            min->right->parent = min;
+        }
+        Transplant(np, min);
+        min->left = np->left;
+        min->left->parent = min;
+    }
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Rotate(Node* n) noexcept {
+    Node* p = n->parent;
+    Transplant(p, n);
+    if (n == p->left) {
+        p->left = n->right;
+        if (p->left) {
+            p->left->parent = p;
+        }
+        n->right = p;
+    }
+    else {
+        p->right = n->left;
+        if (p->right) {
+            p->right->parent = p;
+        }
+        n->left = p;
+    }
+    p->parent = n;
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Splay(Node* n) noexcept {
+    while (Node* p = n->parent) {
+        if (Node* g = p->parent) {
+            if ((n == p->left) == (p == g->left)) {
+                Rotate(p);  // Zig-zig.
+            }
+            else {
+                Rotate(n);  // Zig-zag.
+            }
+        }
+        Rotate(n);
+    }
+}
+
+/**
+*   Stops short of the root: a zig-zig lifts only the parent and continues from it,
+*   so the accessed node ends up near half its former depth.
+*/
+template <typename K, class I, Access A>
+void Tree<K, I, A>::SemiSplay(Node* n) noexcept {
+    while (n->parent && n->parent->parent) {
+        Node* p = n->parent;
+        if ((n == p->left) == (p == p->parent->left)) {
+            Rotate(p);
+            n = p;
+        }
+        else {
+            Rotate(n);
+            Rotate(n);
+        }
+    }
+}
+
+template <typename K, class I, Access A>
+void Tree<K, I, A>::Transplant(Node* m, Node* n) { 
     if (n) {
         n->parent = m->parent;
     }
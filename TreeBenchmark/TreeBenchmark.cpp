@@ -0,0 +1,508 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../BufferedTree.hpp"
+#include "../List.hpp"
+#include "../RadixTree.hpp"
+#include "../ShardedTree.hpp"
+#include "../Tree.hpp"
+
+/**
+*   Benchmarks
+*    Each case times its workloads with steady_clock and prints one line per workload in
+*    milliseconds. Results are checked so the optimizer cannot drop the work. Timings are
+*    only meaningful in Release builds.
+*/
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    template <class F>
+    double Time(F f) {
+        Clock::time_point start = Clock::now();
+        f();
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void Report(const char* bench, const char* workload, double ms) {
+        std::cout << bench << " / " << workload << ": " << ms << " ms\n";
+    }
+
+    void Check(bool ok, const char* what) {
+        if (!ok) {
+            throw std::logic_error(what);
+        }
+    }
+
+    std::vector<int> Shuffled(int n, unsigned seed) {
+        std::vector<int> v(n);
+        for (int i = 0; i < n; ++i) {
+            v[i] = i;
+        }
+        std::shuffle(v.begin(), v.end(), std::mt19937{ seed });
+        return v;
+    }
+
+    /**
+    * Sequential stream of n keys, 2 * i + 1 for i in [0, n), with each key displaced by
+    * up to 'jitter' positions when jitter is non-zero.
+    */
+    std::vector<int> Stream(int n, int jitter, unsigned seed) {
+        std::vector<int> v(n);
+        for (int i = 0; i < n; ++i) {
+            v[i] = 2 * i + 1;
+        }
+        std::mt19937 g{ seed };
+        for (int i = 0; jitter && i + jitter < n; i += jitter) {
+            std::shuffle(v.begin() + i, v.begin() + i + jitter, g);
+        }
+        return v;
+    }
+
+    /**
+    * SearchBatch
+    *   Random lookups over a tree of random keys, one at a time and in batches of 64.
+    */
+    void SearchBatch() {
+        const int size = 1 << 20;
+        const std::size_t batch = 64;
+        Tree<int, int> t;
+        for (int k : Shuffled(size, 1)) {
+            t.Insert(k, int{ k });
+        }
+        std::vector<int> probes = Shuffled(size, 2);
+        const Tree<int, int>& ct = t;
+
+        std::size_t found{};
+        Report("SearchBatch", "Search", Time([&] {
+            for (int k : probes) {
+                found += ct.Search(k) ? 1 : 0;
+            }
+        }));
+        Check(found == probes.size(), "Search missed a key.");
+
+        std::vector<Tree<int, int>::Node*> nodes(batch);
+        found = 0;
+        Report("SearchBatch", "SearchBatch", Time([&] {
+            for (std::size_t i = 0; i < probes.size(); i += batch) {
+                ct.SearchBatch(&probes[i], nodes.data(), batch);
+                for (auto* n : nodes) {
+                    found += n ? 1 : 0;
+                }
+            }
+        }));
+        Check(found == probes.size(), "SearchBatch missed a key.");
+    }
+
+    /**
+    * Finger
+    *   Sequential and near-sequential streams of odd keys into a tree of random even
+    *   keys, inserted from the root and hinted with the previous node; then the even keys
+    *   are looked up in order from the root and from the previous result. Last, 2^14
+    *   ascending keys build a right spine, where a root descent walks the whole chain.
+    */
+    void Finger() {
+        const int size = 1 << 18;
+        std::vector<int> evens = Shuffled(size, 3);
+        for (int& k : evens) {
+            k *= 2;
+        }
+        for (int jitter : { 0, 8 }) {
+            const char* stream = jitter ? "near-sequential" : "sequential";
+            std::vector<int> odds = Stream(size, jitter, 4);
+            Tree<int, int> rooted;
+            Tree<int, int> hinted;
+            for (int k : evens) {
+                rooted.Insert(k, int{ k });
+                hinted.Insert(k, int{ k });
+            }
+
+            std::cout << stream << ":\n";
+            Report("Finger", "Insert", Time([&] {
+                for (int k : odds) {
+                    rooted.Insert(k, int{ k });
+                }
+            }));
+            Report("Finger", "Insert(hint)", Time([&] {
+                Tree<int, int>::Node* hint{};
+                for (int k : odds) {
+                    hint = hinted.Insert(hint, k, int{ k });
+                }
+            }));
+            Check(rooted.Walk() == hinted.Walk(), "Hinted insertion differs.");
+
+            const Tree<int, int>& ct = hinted;
+            std::vector<int> probes = Stream(size, jitter, 5);
+            for (int& k : probes) {
+                --k;
+            }
+            std::size_t found{};
+            Report("Finger", "Search", Time([&] {
+                for (int k : probes) {
+                    found += ct.Search(k) ? 1 : 0;
+                }
+            }));
+            Report("Finger", "FingerSearch", Time([&] {
+                Tree<int, int>::Node* finger{};
+                for (int k : probes) {
+                    if (Tree<int, int>::Node* n = ct.FingerSearch(finger, k)) {
+                        finger = n;
+                        ++found;
+                    }
+                }
+            }));
+            Check(found == 2 * probes.size(), "Lookup missed a key.");
+        }
+
+        const int spine = 1 << 14;
+        Tree<int, int> rooted;
+        Tree<int, int> hinted;
+        std::cout << "ascending chain:\n";
+        Report("Finger", "Insert", Time([&] {
+            for (int k = 0; k < spine; ++k) {
+                rooted.Insert(k, int{ k });
+            }
+        }));
+        Report("Finger", "Insert(hint)", Time([&] {
+            Tree<int, int>::Node* hint{};
+            for (int k = 0; k < spine; ++k) {
+                hint = hinted.Insert(hint, k, int{ k });
+            }
+        }));
+        const Tree<int, int>& ct = hinted;
+        std::size_t found{};
+        Report("Finger", "Search", Time([&] {
+            for (int k = 0; k < spine; ++k) {
+                found += ct.Search(k) ? 1 : 0;
+            }
+        }));
+        Report("Finger", "FingerSearch", Time([&] {
+            Tree<int, int>::Node* finger{};
+            for (int k = 0; k < spine; ++k) {
+                if (Tree<int, int>::Node* n = ct.FingerSearch(finger, k)) {
+                    finger = n;
+                    ++found;
+                }
+            }
+        }));
+        Check(found == 2 * static_cast<std::size_t>(spine), "Lookup missed a key.");
+    }
+
+    /**
+    * Lists
+    *   Fill with 2^20 ints, sum them in order and clear; then run 2^22 push/pop pairs
+    *   through a queue held at 1024 items. 'front' reads the first item, 'pop' removes it.
+    */
+    template <class L, class Sum, class Front, class Pop>
+    void Churn(const char* name, Sum sum, Front front, Pop pop) {
+        const int size = 1 << 20;
+        const int ops = 1 << 22;
+        const int depth = 1024;
+        long long total{};
+        Report(name, "fill, sum, clear", Time([&] {
+            L l;
+            for (int k = 0; k < size; ++k) {
+                l.push_back(k);
+            }
+            total += sum(l);
+        }));
+        Check(total == (static_cast<long long>(size) - 1) * size / 2, "Sum differs.");
+        total = 0;
+        Report(name, "queue", Time([&] {
+            L l;
+            for (int k = 0; k < depth; ++k) {
+                l.push_back(k);
+            }
+            for (int k = 0; k < ops; ++k) {
+                l.push_back(k);
+                total += front(l);
+                pop(l);
+            }
+        }));
+        Check(total > 0, "Queue drained.");
+    }
+
+    /**
+    *  Adapts the pooled lists to the std::list interface used by Churn().
+    */
+    template <class L>
+    struct Std : L {
+        void push_back(int k) { L::PushBack(std::move(k)); }
+    };
+
+    void Lists() {
+        auto sumStd = [](const auto& l) {
+            long long s{};
+            for (int k : l) {
+                s += k;
+            }
+            return s;
+        };
+        auto sumNodes = [](const auto& l) {
+            long long s{};
+            for (auto* n = l.Front(); n; n = n->next) {
+                s += n->item;
+            }
+            return s;
+        };
+        auto sumBlocks = [](const auto& l) {
+            long long s{};
+            l.ForEach([&](int k) { s += k; });
+            return s;
+        };
+        auto frontStd = [](const auto& l) { return l.front(); };
+        auto frontNode = [](const auto& l) { return l.Front()->item; };
+        auto frontItem = [](const auto& l) { return *l.Front(); };
+        auto popStd = [](auto& l) { l.pop_front(); };
+        auto pop = [](auto& l) { l.PopFront(); };
+
+        Churn<std::list<int>>("std::list", sumStd, frontStd, popStd);
+        Churn<std::deque<int>>("std::deque", sumStd, frontStd, popStd);
+        Churn<Std<ForwardList<int>>>("ForwardList", sumNodes, frontNode, pop);
+        Churn<Std<List<int>>>("List", sumNodes, frontNode, pop);
+        Churn<Std<UnrolledList<int>>>("UnrolledList", sumBlocks, frontItem, pop);
+    }
+
+    /**
+    * Buffered
+    *   Ingests 2^18 random keys into a Tree and a BufferedTree, then looks each key up.
+    *   Then ingests 2^14 ascending keys, which a plain Tree links into a chain.
+    */
+    void Buffered() {
+        const int size = 1 << 18;
+        std::vector<int> keys = Shuffled(size, 6);
+        std::vector<int> probes = Shuffled(size, 7);
+        Tree<int, int> plain;
+        BufferedTree<int, int> buffered;
+        std::size_t found{};
+
+        Report("Buffered", "Tree Insert", Time([&] {
+            for (int k : keys) {
+                plain.Insert(k, int{ k });
+            }
+        }));
+        Report("Buffered", "BufferedTree Insert", Time([&] {
+            for (int k : keys) {
+                buffered.Insert(k, int{ k });
+            }
+            buffered.Flush();
+        }));
+        Report("Buffered", "Tree Search", Time([&] {
+            for (int k : probes) {
+                found += plain.Search(k) ? 1 : 0;
+            }
+        }));
+        Report("Buffered", "BufferedTree Search", Time([&] {
+            for (int k : probes) {
+                found += buffered.Search(k) ? 1 : 0;
+            }
+        }));
+        Check(found == 2 * probes.size(), "Lookup missed a key.");
+        std::cout << "Buffered / height: Tree " << plain.Height() << ", BufferedTree " << buffered.Height() << "\n";
+
+        const int ascending = 1 << 14;
+        Tree<int, int> chain;
+        BufferedTree<int, int> batched;
+        Report("Buffered", "Tree Insert ascending", Time([&] {
+            for (int k = 0; k < ascending; ++k) {
+                chain.Insert(k, int{ k });
+            }
+        }));
+        Report("Buffered", "BufferedTree Insert ascending", Time([&] {
+            for (int k = 0; k < ascending; ++k) {
+                batched.Insert(k, int{ k });
+            }
+            batched.Flush();
+        }));
+        std::cout << "Buffered / height: Tree " << chain.Height() << ", BufferedTree " << batched.Height() << "\n";
+    }
+
+    /**
+    * Sharded
+    *   Loads 2^18 random keys that all route to the last of four shards at first, so
+    *   skewed pairs are evened during the load, against a plain Tree. Then rebalances to
+    *   even shares and looks each key up before and after.
+    */
+    void Sharded() {
+        const int size = 1 << 18;
+        std::vector<int> keys = Shuffled(size, 8);
+        ShardedTree<int, int> t{ { -3, -2, -1 } };
+        Tree<int, int> plain;
+        Report("Sharded", "Tree Insert", Time([&] {
+            for (int k : keys) {
+                plain.Insert(k, int{ k });
+            }
+        }));
+        Report("Sharded", "Insert", Time([&] {
+            for (int k : keys) {
+                t.Insert(k, int{ k });
+            }
+        }));
+        std::vector<int> probes = Shuffled(size, 9);
+        std::size_t found{};
+        auto search = [&] {
+            for (int k : probes) {
+                found += t.Search(k) ? 1 : 0;
+            }
+        };
+
+        Report("Sharded", "Search before", Time(search));
+        std::cout << "Sharded / height before: " << t.Height() << "\n";
+        Report("Sharded", "Rebalance", Time([&] { t.Rebalance(); }));
+        Report("Sharded", "Search after", Time(search));
+        std::cout << "Sharded / height after: " << t.Height() << "\n";
+        Check(found == 2 * probes.size(), "Lookup missed a key.");
+        Check(t.Route(size / 4 - 1) == 0 && t.Route(size / 4) == 1, "Shares differ.");
+    }
+
+    /**
+    * Radix
+    *   Inserts the keys in the given order, looks each one up in random order and scans
+    *   them in key order, for Tree, RadixTree and std::map.
+    */
+    template <typename K>
+    void Ordered(const char* label, const std::vector<K>& keys, const std::vector<K>& probes) {
+        std::size_t found{};
+        std::size_t scanned{};
+        std::cout << label << ":\n";
+
+        Tree<K, int> tree;
+        Report("Radix", "Tree Insert", Time([&] {
+            for (auto& k : keys) {
+                tree.Insert(k, 0);
+            }
+        }));
+        const Tree<K, int>& ct = tree;
+        Report("Radix", "Tree Search", Time([&] {
+            for (auto& k : probes) {
+                found += ct.Search(k) ? 1 : 0;
+            }
+        }));
+        Report("Radix", "Tree scan", Time([&] {
+            for (auto* n = ct.Minimum(); n; n = ct.Successor(n)) {
+                ++scanned;
+            }
+        }));
+
+        RadixTree<K, int> radix;
+        Report("Radix", "RadixTree Insert", Time([&] {
+            for (auto& k : keys) {
+                radix.Insert(k, 0);
+            }
+        }));
+        Report("Radix", "RadixTree Search", Time([&] {
+            for (auto& k : probes) {
+                found += radix.Search(k) ? 1 : 0;
+            }
+        }));
+        Report("Radix", "RadixTree scan", Time([&] {
+            for (auto* n = radix.Minimum(); n; n = radix.Successor(n)) {
+                ++scanned;
+            }
+        }));
+
+        std::map<K, int> map;
+        Report("Radix", "std::map insert", Time([&] {
+            for (auto& k : keys) {
+                map.emplace(k, 0);
+            }
+        }));
+        Report("Radix", "std::map find", Time([&] {
+            for (auto& k : probes) {
+                found += map.find(k) != map.end() ? 1 : 0;
+            }
+        }));
+        Report("Radix", "std::map scan", Time([&] {
+            for (auto& p : map) {
+                scanned += p.second + 1;
+            }
+        }));
+        Check(found == 3 * probes.size() && scanned == 3 * keys.size(), "Containers differ.");
+    }
+
+    void Radix() {
+        const int size = 1 << 18;
+        std::vector<int> ints = Shuffled(size, 10);
+        for (int& k : ints) {
+            k = k * 7919 - size;    // Spread over both signs.
+        }
+        std::vector<int> intProbes = ints;
+        std::shuffle(intProbes.begin(), intProbes.end(), std::mt19937{ 11 });
+        Ordered("int keys", ints, intProbes);
+
+        // Long shared prefixes, as in path-like or namespaced identifiers.
+        std::vector<std::wstring> strings;
+        for (int k : Shuffled(size / 2, 12)) {
+            strings.push_back(L"/records/customers/region-" + std::to_wstring(k % 16) + L"/account-" + std::to_wstring(k));
+        }
+        std::vector<std::wstring> stringProbes = strings;
+        std::shuffle(stringProbes.begin(), stringProbes.end(), std::mt19937{ 13 });
+        Ordered("wstring keys", strings, stringProbes);
+    }
+
+    /**
+    * Zipf
+    *   2^21 lookups into 2^20 random keys, the key of rank r drawn with weight r^-s, for
+    *   each Access policy and skew s. Static lookups go through the const Search().
+    */
+    template <Access A>
+    void Skewed(const char* policy, const std::vector<int>& keys, const std::vector<int>& probes) {
+        Tree<int, int, A> t;
+        for (int k : keys) {
+            t.Insert(k, int{ k });
+        }
+        std::size_t found{};
+        Report("Zipf", policy, Time([&] {
+            for (int k : probes) {
+                if constexpr (Access::Static == A) {
+                    found += static_cast<const Tree<int, int, A>&>(t).Search(k) ? 1 : 0;
+                }
+                else {
+                    found += t.Search(k) ? 1 : 0;
+                }
+            }
+        }));
+        Check(found == probes.size(), "Lookup missed a key.");
+    }
+
+    void Zipf() {
+        const int size = 1 << 20;
+        const int lookups = 1 << 21;
+        std::vector<int> keys = Shuffled(size, 14);
+        std::vector<int> ranked = Shuffled(size, 15);   // Hot keys sit anywhere in the tree.
+        for (double skew : { 1.0, 1.5 }) {
+            std::vector<double> weights(size);
+            for (int r = 0; r < size; ++r) {
+                weights[r] = std::pow(r + 1.0, -skew);
+            }
+            std::discrete_distribution<int> rank{ weights.begin(), weights.end() };
+            std::mt19937 g{ 16 };
+            std::vector<int> probes(lookups);
+            for (int& k : probes) {
+                k = ranked[rank(g)];
+            }
+
+            std::cout << "skew " << skew << ":\n";
+            Skewed<Access::Static>("Static", keys, probes);
+            Skewed<Access::Splay>("Splay", keys, probes);
+            Skewed<Access::SemiSplay>("SemiSplay", keys, probes);
+        }
+    }
+}
+
+int main() {
+    SearchBatch();
+    Finger();
+    Lists();
+    Buffered();
+    Sharded();
+    Radix();
+    Zipf();
+}
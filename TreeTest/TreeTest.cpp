@@ -20,7 +20,15 @@ REGISTER_TYPED_TEST_SUITE_P(TreeTest,
     Predecessor,
     Successor,
     Insert,
-    Delete);
+    Delete,
+    SearchBatch,
+    ForEachInRange,
+    EraseRange,
+    FingerSearch,
+    HintedInsert,
+    Extract,
+    Splay,
+    SplitJoin);
 
 template<typename T>
 struct TypeName {
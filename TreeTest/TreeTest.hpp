@@ -277,4 +277,344 @@ TYPED_TEST_P(TreeTest, Delete) {
     this->BalancedTr.Delete(nullptr);
     this->BranchingTr.Delete(nullptr);
     this->EmptyTr.Delete(nullptr);
-}
\ No newline at end of file
+}
+
+/**
+* SearchBatch
+*   Matches the result of Search for every key in the batch.
+*/
+TYPED_TEST_P(TreeTest, SearchBatch) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+
+    // More keys than a single group, including missing ones.
+    std::vector<int> batch;
+    for (int r = 0; r < 3; ++r) {
+        for (auto& k : this->rkeys) {
+            batch.push_back(k);
+        }
+        batch.push_back(static_cast<int>(this->keys.size()) + r);
+    }
+    std::vector<Node*> pBa(batch.size());
+    std::vector<Node*> pBr(batch.size());
+    std::vector<Node*> pEm(batch.size(), reinterpret_cast<Node*>(&batch));
+    this->BalancedTr.SearchBatch(batch.data(), pBa.data(), batch.size());
+    this->BranchingTr.SearchBatch(batch.data(), pBr.data(), batch.size());
+    this->EmptyTr.SearchBatch(batch.data(), pEm.data(), batch.size());
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(this->BalancedTr.Search(batch[i]), pBa[i]);
+        EXPECT_EQ(this->BranchingTr.Search(batch[i]), pBr[i]);
+        EXPECT_EQ(nullptr, pEm[i]);
+    }
+
+    // Empty batch.
+    this->BalancedTr.SearchBatch(nullptr, nullptr, 0);
+}
+
+/**
+* ForEachInRange
+*   Visits nodes with keys in [lo, hi] in order, stopping when the visitor returns false.
+*/
+TYPED_TEST_P(TreeTest, ForEachInRange) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+
+    std::vector<int> visited;
+    auto collect = [&visited](Node* n) { visited.push_back(n->key); return true; };
+    EXPECT_EQ(4u, this->BranchingTr.ForEachInRange(3, 6, collect));
+    EXPECT_EQ((std::vector<int>{ 3, 4, 5, 6 }), visited);
+
+    // Bounds need not be present in the tree.
+    visited.clear();
+    EXPECT_EQ(3u, this->BalancedTr.ForEachInRange(-5, 2, collect));
+    EXPECT_EQ((std::vector<int>{ 0, 1, 2 }), visited);
+
+    // Early termination.
+    visited.clear();
+    auto firstTwo = [&visited](Node* n) { visited.push_back(n->key); return visited.size() < 2; };
+    EXPECT_EQ(2u, this->BranchingTr.ForEachInRange(0, 9, firstTwo));
+    EXPECT_EQ((std::vector<int>{ 0, 1 }), visited);
+
+    // Empty ranges.
+    EXPECT_EQ(0u, this->BranchingTr.ForEachInRange(6, 3, collect));
+    EXPECT_EQ(0u, this->BranchingTr.ForEachInRange(10, 20, collect));
+    EXPECT_EQ(0u, this->EmptyTr.ForEachInRange(0, 9, collect));
+}
+
+/**
+* EraseRange
+*   Deletes every node with a key in [lo, hi] and keeps the rest ordered.
+*/
+TYPED_TEST_P(TreeTest, EraseRange) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+
+    EXPECT_EQ(5u, this->BalancedTr.EraseRange(2, 6));
+    EXPECT_EQ(5u, this->BranchingTr.EraseRange(2, 6));
+    for (auto& k : this->keys) {
+        bool erased = 2 <= k && k <= 6;
+        EXPECT_EQ(erased, nullptr == this->BalancedTr.Search(k));
+        EXPECT_EQ(erased, nullptr == this->BranchingTr.Search(k));
+    }
+
+    // Remaining nodes are linked in order in both directions.
+    std::vector<int> remaining{ 0, 1, 7, 8, 9 };
+    Node* n = this->BranchingTr.Minimum();
+    for (auto& k : remaining) {
+        EXPECT_EQ(k, n->key);
+        n = this->BranchingTr.Successor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+    n = this->BranchingTr.Maximum();
+    for (auto it = remaining.rbegin(); it != remaining.rend(); ++it) {
+        EXPECT_EQ(*it, n->key);
+        n = this->BranchingTr.Predecessor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+
+    EXPECT_EQ(0u, this->BranchingTr.EraseRange(3, 5));
+    EXPECT_EQ(0u, this->BranchingTr.EraseRange(9, 0));
+    EXPECT_EQ(5u, this->BranchingTr.EraseRange(-10, 10));
+    EXPECT_EQ(nullptr, this->BranchingTr.Minimum());
+    EXPECT_EQ(0u, this->EmptyTr.EraseRange(0, 9));
+
+    // Ascending inserts splay into a left chain as deep as the tree; erasing must not recurse.
+    const int depth = 1 << 17;
+    Tree<int, I, Access::Splay> chain;
+    for (int k = 0; k < depth; ++k) {
+        chain.Insert(k, static_cast<I>(k));
+    }
+    EXPECT_EQ(static_cast<std::size_t>(depth), chain.Height());
+    EXPECT_EQ(1u, chain.EraseRange(0, 0));
+    EXPECT_EQ(static_cast<std::size_t>(depth / 2 - 1), chain.EraseRange(1, depth / 2 - 1));
+    EXPECT_EQ(depth / 2, chain.Minimum()->key);
+    EXPECT_EQ(depth - 1, chain.Maximum()->key);
+    EXPECT_EQ(static_cast<std::size_t>(depth / 2), chain.EraseRange(0, depth));
+    EXPECT_EQ(nullptr, chain.Minimum());
+}
+
+/**
+* FingerSearch
+*   Finds the same key from any starting node as Search does from the root.
+*/
+TYPED_TEST_P(TreeTest, FingerSearch) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+
+    int arbitrary = this->keys.size();
+    for (auto& from : this->keys) {
+        Node* fBa = this->BalancedTr.Search(from);
+        Node* fBr = this->BranchingTr.Search(from);
+        for (auto& k : this->keys) {
+            EXPECT_EQ(this->BalancedTr.Search(k), this->BalancedTr.FingerSearch(fBa, k));
+            EXPECT_EQ(this->BranchingTr.Search(k), this->BranchingTr.FingerSearch(fBr, k));
+        }
+        EXPECT_EQ(nullptr, this->BalancedTr.FingerSearch(fBa, arbitrary));
+        EXPECT_EQ(nullptr, this->BranchingTr.FingerSearch(fBr, -1));
+    }
+    EXPECT_EQ(this->BranchingTr.Search(3), this->BranchingTr.FingerSearch(nullptr, 3));
+    EXPECT_EQ(nullptr, this->EmptyTr.FingerSearch(nullptr, arbitrary));
+
+    // Hinted ascending inserts build a right spine; fingers on it start the descent in place.
+    Tree<int, I> spine;
+    Node* hint{};
+    for (int k = 0; k < 64; k += 2) {
+        hint = spine.Insert(hint, k, static_cast<I>(k));
+    }
+    EXPECT_EQ(32u, spine.Height());
+    for (int from = 0; from < 64; from += 2) {
+        Node* f = spine.Search(from);
+        for (int k = -1; k <= 64; ++k) {
+            EXPECT_EQ(spine.Search(k), spine.FingerSearch(f, k));
+        }
+    }
+}
+
+/**
+* Hinted Insert
+*   Places the new value correctly whether or not the hint is near it.
+*/
+TYPED_TEST_P(TreeTest, HintedInsert) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+
+    // Sequential stream, each hinted by the previous insertion.
+    Node* hint = this->BranchingTr.Maximum();
+    for (int k = 10; k < 20; ++k) {
+        this->BranchingTr.Insert(hint, k, static_cast<I&&>(k));
+        hint = this->BranchingTr.FingerSearch(hint, k);
+        EXPECT_EQ(static_cast<I>(k), hint->item);
+    }
+
+    // Distant hints, in both directions.
+    this->BranchingTr.Insert(this->BranchingTr.Search(0), 20, static_cast<I&&>(20));
+    this->BranchingTr.Insert(this->BranchingTr.Search(19), -1, static_cast<I&&>(-1));
+    this->BranchingTr.Insert(this->BranchingTr.Search(2), 2, static_cast<I&&>(2));
+    this->EmptyTr.Insert(nullptr, 0, static_cast<I&&>(0));
+
+    std::vector<int> expected{ -1, 0, 1, 2, 2 };
+    for (int k = 3; k <= 20; ++k) {
+        expected.push_back(k);
+    }
+    Node* n = this->BranchingTr.Minimum();
+    for (auto& k : expected) {
+        EXPECT_EQ(k, n->key);
+        n = this->BranchingTr.Successor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+    EXPECT_EQ(static_cast<I>(0), this->EmptyTr.Search(0)->item);
+}
+
+/**
+* Extract & Insert(Handle&&)
+*   Moves a node between trees, or re-keys it, without reallocating it.
+*/
+TYPED_TEST_P(TreeTest, Extract) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+    using Handle = typename Tree<int, I>::Handle;
+
+    // 1. Detach a node with two children.
+    Node* pBr = this->BranchingTr.Search(2);
+    Node* address = pBr;
+    Handle h = this->BranchingTr.Extract(&pBr);
+    EXPECT_EQ(nullptr, pBr);
+    EXPECT_EQ(address, h.node);
+    EXPECT_EQ(nullptr, this->BranchingTr.Search(2));
+    EXPECT_EQ(this->BranchingTr.Search(3), this->BranchingTr.Successor(this->BranchingTr.Search(1)));
+
+    // 2. Re-key it and move it into another tree.
+    h->key = 20;
+    this->EmptyTr.Insert(std::move(h));
+    EXPECT_EQ(nullptr, h.node);
+    EXPECT_EQ(address, this->EmptyTr.Search(20));
+    EXPECT_EQ(static_cast<I>(2), this->EmptyTr.Search(20)->item);
+    EXPECT_EQ(nullptr, this->EmptyTr.Successor(address));
+
+    // 3. Return it to its original tree.
+    Node* pEm = address;
+    Handle back = this->EmptyTr.Extract(&pEm);
+    back->key = 2;
+    this->BranchingTr.Insert(std::move(back));
+    EXPECT_EQ(nullptr, this->EmptyTr.Minimum());
+    EXPECT_EQ(address, this->BranchingTr.Search(2));
+    Node* n = this->BranchingTr.Minimum();
+    for (auto& k : this->keys) {
+        EXPECT_EQ(k, n->key);
+        n = this->BranchingTr.Successor(n);
+    }
+
+    // Non-existent values.
+    Node* none{};
+    EXPECT_EQ(nullptr, this->BalancedTr.Extract(&none).node);
+    EXPECT_EQ(nullptr, this->BalancedTr.Extract(nullptr).node);
+    this->BalancedTr.Insert(Handle{ nullptr });
+}
+
+/**
+* Splay & SemiSplay
+*   Self-adjusting access moves found and inserted nodes up while preserving order.
+*/
+TYPED_TEST_P(TreeTest, Splay) {
+    using I = TypeParam;
+    using SplayTree = Tree<int, I, Access::Splay>;
+    using SemiSplayTree = Tree<int, I, Access::SemiSplay>;
+
+    int Br[10] = { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 };
+    SplayTree splay;
+    SemiSplayTree semi;
+    for (auto& k : this->keys) {
+        splay.Insert(Br[k], static_cast<I&&>(Br[k]));
+        semi.Insert(Br[k], static_cast<I&&>(Br[k]));
+
+        // An inserted node becomes the root: its subtree spans the whole tree.
+        auto* n = static_cast<const SplayTree&>(splay).Search(Br[k]);
+        EXPECT_EQ(splay.Minimum(), splay.Minimum(n));
+        EXPECT_EQ(splay.Maximum(), splay.Maximum(n));
+    }
+
+    for (auto& k : this->rkeys) {
+        auto* n = splay.Search(k);
+        EXPECT_EQ(static_cast<I>(k), n->item);
+        EXPECT_EQ(splay.Minimum(), splay.Minimum(n));
+        EXPECT_EQ(splay.Maximum(), splay.Maximum(n));
+
+        // Repeated semi-splaying brings the node next to the root.
+        for (int r = 0; r < 4; ++r) {
+            EXPECT_EQ(static_cast<I>(k), semi.Search(k)->item);
+        }
+        auto* m = static_cast<const SemiSplayTree&>(semi).Search(k);
+        EXPECT_TRUE(semi.Minimum() == semi.Minimum(m) || semi.Maximum() == semi.Maximum(m));
+    }
+
+    // Order is preserved in both directions.
+    auto* n = splay.Minimum();
+    auto* m = semi.Minimum();
+    for (auto& k : this->keys) {
+        EXPECT_EQ(k, n->key);
+        EXPECT_EQ(k, m->key);
+        if (k != this->keys.front()) {
+            EXPECT_EQ(k - 1, splay.Predecessor(n)->key);
+        }
+        n = splay.Successor(n);
+        m = semi.Successor(m);
+    }
+    EXPECT_EQ(nullptr, n);
+    EXPECT_EQ(nullptr, m);
+    EXPECT_EQ(nullptr, splay.Search(static_cast<int>(this->keys.size())));
+
+    // Deletion still works on the restructured tree.
+    for (auto& k : this->keys) {
+        auto* d = splay.Search(k);
+        splay.Delete(&d);
+        EXPECT_EQ(nullptr, static_cast<const SplayTree&>(splay).Search(k));
+    }
+    EXPECT_EQ(nullptr, splay.Minimum());
+}
+
+/**
+* Split & Join
+*   Moves the keys above a boundary into another tree and back, keeping order and height.
+*/
+TYPED_TEST_P(TreeTest, SplitJoin) {
+    using I = TypeParam;
+    using Node = typename Tree<int, I>::Node;
+
+    std::size_t height = this->BranchingTr.Height();
+    Tree<int, I> upper;
+    this->BranchingTr.Split(4, upper);
+    EXPECT_EQ(4, this->BranchingTr.Maximum()->key);
+    EXPECT_EQ(5, upper.Minimum()->key);
+    EXPECT_GE(height, this->BranchingTr.Height());
+    EXPECT_GE(height, upper.Height());
+    for (auto& k : this->keys) {
+        EXPECT_EQ(k <= 4, nullptr != this->BranchingTr.Search(k));
+        EXPECT_EQ(k > 4, nullptr != upper.Search(k));
+    }
+
+    this->BranchingTr.Join(upper);
+    EXPECT_EQ(nullptr, upper.Minimum());
+    EXPECT_GE(height + 1, this->BranchingTr.Height());
+    Node* n = this->BranchingTr.Minimum();
+    for (auto& k : this->keys) {
+        EXPECT_EQ(k, n->key);
+        n = this->BranchingTr.Successor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+    n = this->BranchingTr.Maximum();
+    for (auto& k : this->rkeys) {
+        EXPECT_EQ(k, n->key);
+        n = this->BranchingTr.Predecessor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+
+    // Boundaries outside the keys move everything or nothing.
+    this->BranchingTr.Split(9, upper);
+    EXPECT_EQ(nullptr, upper.Minimum());
+    this->BranchingTr.Split(-1, upper);
+    EXPECT_EQ(nullptr, this->BranchingTr.Minimum());
+    this->EmptyTr.Join(upper);
+    EXPECT_EQ(9, this->EmptyTr.Maximum()->key);
+    EXPECT_EQ(nullptr, upper.Maximum());
+}
@@ -0,0 +1,150 @@
+#include "TreeTestBuffered.hpp"
+
+/**
+* Buffering
+*   Holds updates until the buffer fills or a read needs them.
+*/
+TEST_F(TreeTestBuffered, Buffering) {
+    EXPECT_EQ(2u, BranchingTr.Pending());   // Ten inserts with a capacity of four.
+
+    EmptyTr.Insert(1, L"1");
+    EmptyTr.Insert(0, L"0");
+    EXPECT_EQ(2u, EmptyTr.Pending());
+    EXPECT_EQ(L"0", EmptyTr.Minimum()->item);
+    EXPECT_EQ(0u, EmptyTr.Pending());
+
+    EmptyTr.Flush();
+    EXPECT_EQ(nullptr, EmptyTr.Search(2));
+}
+
+/**
+* Search
+*   Sees every buffered insert and delete.
+*/
+TEST_F(TreeTestBuffered, Search) {
+    for (auto& k : keys) {
+        EXPECT_EQ(std::to_wstring(k), BranchingTr.Search(k)->item);
+    }
+
+    BranchingTr.Delete(3);
+    BranchingTr.Insert(10, L"10");
+    BranchingTr.Delete(11);     // Non-existent value.
+    EXPECT_EQ(nullptr, BranchingTr.Search(3));
+    EXPECT_EQ(L"10", BranchingTr[10]->item);
+    EXPECT_EQ(nullptr, EmptyTr.Search(3));
+}
+
+/**
+* Ordering
+*   Applies messages on the same key in the order they were issued.
+*/
+TEST_F(TreeTestBuffered, Ordering) {
+    EmptyTr.Insert(1, L"a");
+    EmptyTr.Delete(1);
+    EmptyTr.Insert(1, L"b");
+    EXPECT_EQ(L"b", EmptyTr.Search(1)->item);
+
+    EmptyTr.Delete(1);
+    EmptyTr.Insert(1, L"c");
+    EmptyTr.Delete(1);
+    EXPECT_EQ(nullptr, EmptyTr.Search(1));
+}
+
+/**
+* Predecessor & Successor
+*   Walk the flushed tree in key order.
+*/
+TEST_F(TreeTestBuffered, Order) {
+    for (short k = 20; k > 10; --k) {
+        BranchingTr.Insert(k, std::to_wstring(k));
+        BranchingTr.Delete(k - 10);
+    }
+    std::vector<short> expected{ 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+    auto* n = BranchingTr.Minimum();
+    for (auto& k : expected) {
+        EXPECT_EQ(std::to_wstring(k), n->item);
+        n = BranchingTr.Successor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+    EXPECT_EQ(L"19", BranchingTr.Predecessor(BranchingTr.Maximum())->item);
+
+    auto* min = BranchingTr.Minimum();
+    BranchingTr.Delete(&min);
+    EXPECT_EQ(nullptr, min);
+    EXPECT_EQ(expected.size() - 1, BranchingTr.Walk().size());
+}
+
+/**
+* Shape
+*   Applies each batch median-first, so ascending input stays shallow and random input
+*   grows no taller than the plain Tree would.
+*/
+TEST_F(TreeTestBuffered, Shape) {
+    const int size = 4096;
+    BufferedTree<int, int, 1024> ascending;
+    for (int k = 0; k < size; ++k) {
+        ascending.Insert(k, int{ k });
+    }
+    EXPECT_GE(48u, ascending.Height());   // Four batches of eleven levels each; a plain Tree has 4096.
+
+    std::vector<int> shuffled(size);
+    for (int k = 0; k < size; ++k) {
+        shuffled[k] = k;
+    }
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{ 7 });
+    BufferedTree<int, int, 1024> buffered;
+    Tree<int, int> plain;
+    for (int k : shuffled) {
+        buffered.Insert(k, int{ k });
+        plain.Insert(k, int{ k });
+    }
+    EXPECT_GE(plain.Height(), buffered.Height());
+    EXPECT_EQ(plain.Walk(), buffered.Walk());
+}
+
+/**
+* Batch
+*   Pushes a mixed batch down in one pass, settling runs on a key in issue order, and
+*   follows a degenerate chain without recursing.
+*/
+TEST_F(TreeTestBuffered, Batch) {
+    const int size = 1 << 16;
+    Tree<int, int> chain;
+    for (int k = 0; k < size; k += 2) {
+        chain.Insert(k, int{ k });
+    }
+    std::vector<Tree<int, int>::Update> batch;
+    std::map<int, int> expected;
+    for (int k = 0; k < size; k += 2) {
+        expected[k] = k;
+    }
+    for (int k = 0; k < size; ++k) {
+        if (k % 4 == 0) {
+            batch.push_back({ k, false, 0 });           // Deletes an existing node.
+            expected.erase(k);
+        }
+        else if (k % 4 == 1) {
+            batch.push_back({ k, true, k });            // Lands below a leaf.
+            expected[k] = k;
+        }
+        else if (k % 8 == 3) {
+            batch.push_back({ k, true, -k });           // Inserted, then deleted.
+            batch.push_back({ k, false, 0 });
+        }
+    }
+    batch.push_back({ size, false, 0 });                // Finds nothing.
+    batch.push_back({ size + 1, true, 1 });
+    batch.push_back({ size + 1, true, 2 });
+    batch.push_back({ size + 1, false, 0 });            // Takes the older insert.
+    expected[size + 1] = 2;
+    chain.Apply(batch.data(), batch.size());
+
+    auto walk = chain.Walk();
+    ASSERT_EQ(expected.size(), walk.size());
+    auto e = expected.begin();
+    for (auto& [k, i] : walk) {
+        EXPECT_EQ(e->first, k);
+        EXPECT_EQ(e->second, i);
+        ++e;
+    }
+}
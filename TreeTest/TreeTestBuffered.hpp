@@ -0,0 +1,26 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include "../BufferedTree.hpp"
+
+/**
+* class TreeTestBuffered
+*   Test fixture for the BufferedTree interface.
+*/
+class TreeTestBuffered : public testing::Test {
+protected:
+    void SetUp() override {
+        short Br[10] = { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 };
+
+        for (auto& k : keys) {
+            BranchingTr.Insert(Br[k], std::move(std::to_wstring(Br[k])));
+        }
+    }
+
+    BufferedTree<short, std::wstring, 4> BranchingTr;
+    BufferedTree<short, std::wstring, 4> EmptyTr;
+
+    const std::vector<short> keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+};
@@ -0,0 +1,105 @@
+#include "TreeTestCompact.hpp"
+
+/**
+* Layout
+*   Nodes carry two 32-bit links and no parent pointer or vtable.
+*/
+TEST_F(TreeTestCompact, Layout) {
+    EXPECT_EQ(sizeof(int) * 4, sizeof(CompactTree<int, int>::Node));
+    EXPECT_EQ(sizeof(short) * 2 + sizeof(std::uint16_t) * 2, sizeof(CompactTree<short, short, std::uint16_t>::Node));
+}
+
+/**
+* Search
+*   Returns either a node pointer to the corresponding value or nullptr.
+*/
+TEST_F(TreeTestCompact, Search) {
+    using Node = CompactTree<int, int>::Node;
+
+    for (auto& k : keys) {
+        Node* pBa = BalancedTr.Search(k);
+        Node* pBr = BranchingTr.Search(k);
+        EXPECT_EQ(k, pBa->item);
+        EXPECT_EQ(k, pBr->item);
+    }
+
+    int arbitrary = keys.size();
+    EXPECT_EQ(nullptr, BalancedTr.Search(arbitrary));
+    EXPECT_EQ(nullptr, BranchingTr.Search(arbitrary));
+    EXPECT_EQ(nullptr, EmptyTr.Search(arbitrary));
+}
+
+/**
+* Predecessor & Successor
+*   Returns either a valid node pointer to the corresponding value or nullptr.
+*/
+TEST_F(TreeTestCompact, Order) {
+    using Node = CompactTree<int, int>::Node;
+
+    for (auto& k : keys) {
+        Node* pBr = BranchingTr.Search(k);
+        EXPECT_EQ(k == keys.front() ? nullptr : BranchingTr.Search(k - 1), BranchingTr.Predecessor(pBr));
+        EXPECT_EQ(k == keys.back() ? nullptr : BranchingTr.Search(k + 1), BranchingTr.Successor(pBr));
+    }
+    EXPECT_EQ(nullptr, EmptyTr.Predecessor(nullptr));
+    EXPECT_EQ(nullptr, EmptyTr.Successor(nullptr));
+    EXPECT_EQ(nullptr, EmptyTr.Minimum());
+    EXPECT_EQ(nullptr, EmptyTr.Maximum());
+}
+
+/**
+* Delete
+*   Deletes the corresponding node and recycles its slot for the next insertion.
+*/
+TEST_F(TreeTestCompact, Delete) {
+    using Node = CompactTree<int, int>::Node;
+
+    for (auto& k : keys) { // 'keys' contains key values in ascending order.
+        Node* pBa = BalancedTr.Search(k);
+        Node* pBr = BranchingTr.Search(k);
+        EXPECT_EQ(pBa, BalancedTr.Minimum());
+        EXPECT_EQ(pBr, BranchingTr.Minimum());
+        BalancedTr.Delete(&pBa);
+        BranchingTr.Delete(&pBr);
+        EXPECT_EQ(nullptr, pBa);
+        EXPECT_EQ(nullptr, pBr);
+        EXPECT_EQ(nullptr, BranchingTr.Search(k));
+    }
+    EXPECT_EQ(nullptr, BranchingTr.Minimum());
+
+    // Internal node with two children.
+    CompactTree<int, int> tr;
+    for (int k : { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 }) {
+        tr.Insert(k, static_cast<int&&>(k));
+    }
+    Node* two = tr.Search(2);
+    tr.Delete(&two);
+    std::vector<std::pair<int, int>> v = tr.Walk();
+    EXPECT_EQ(9u, v.size());
+    EXPECT_EQ(3, v[2].first);
+
+    // The freed slot is reused.
+    Node* freed = tr.Search(3);
+    tr.Delete(&freed);
+    tr.Insert(10, 10);
+    EXPECT_EQ(10, tr.Maximum()->item);
+
+    BalancedTr.Delete(nullptr);
+    EmptyTr.Delete(nullptr);
+}
+
+/**
+* Insert
+*   Grows the pool across chunk boundaries without moving existing nodes.
+*/
+TEST_F(TreeTestCompact, Insert) {
+    using Node = CompactTree<int, int>::Node;
+
+    Node* first = BranchingTr.Search(5);
+    for (int k = 10; k < 1000; ++k) {
+        BranchingTr.Insert(k, static_cast<int&&>(k));
+    }
+    EXPECT_EQ(first, BranchingTr.Search(5));
+    EXPECT_EQ(1000u, BranchingTr.Walk().size());
+    EXPECT_EQ(999, BranchingTr.Maximum()->item);
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <gtest/gtest.h>
+#include "../CompactTree.hpp"
+
+/**
+* class TreeTestCompact
+*   Test fixture for the CompactTree interface.
+*/
+class TreeTestCompact : public testing::Test {
+protected:
+    void SetUp() override {
+        int Ba[10] = { 5, 6, 7, 8, 9, 4, 3, 2, 1, 0 };
+        int Br[10] = { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 };
+        /**
+        * Branching Tree       5
+        *                     / \
+        *                    4   6
+        *                   /     \
+        *                  2       9
+        *                 / \     /
+        *                1   3   7
+        *               /         \
+        *              0           8
+        */
+
+        for (auto& k : keys) {
+            BalancedTr.Insert(Ba[k], static_cast<int&&>(Ba[k]));
+        }
+        for (auto& k : keys) {
+            BranchingTr.Insert(Br[k], static_cast<int&&>(Br[k]));
+        }
+    }
+
+    CompactTree<int, int> EmptyTr;
+    CompactTree<int, int> BalancedTr;
+    CompactTree<int, int> BranchingTr;
+
+    const std::vector<int>  keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const std::vector<int> rkeys{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+};
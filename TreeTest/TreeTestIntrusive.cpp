@@ -0,0 +1,134 @@
+#include "TreeTestIntrusive.hpp"
+
+/**
+* Search
+*   Returns the linked object itself rather than a copy.
+*/
+TEST_F(TreeTestIntrusive, Search) {
+    for (auto& k : keys) {
+        EXPECT_EQ(&entries[k], BranchingTr.Search(k));
+        EXPECT_EQ(std::to_wstring(k), BranchingTr[k]->item);
+    }
+
+    short arbitrary = keys.size();
+    EXPECT_EQ(nullptr, BranchingTr.Search(arbitrary));
+    EXPECT_EQ(nullptr, EmptyTr.Search(arbitrary));
+}
+
+/**
+* Minimum, Maximum, Predecessor & Successor
+*   Returns either a valid object pointer or nullptr.
+*/
+TEST_F(TreeTestIntrusive, Order) {
+    EXPECT_EQ(&entries[0], BranchingTr.Minimum());
+    EXPECT_EQ(&entries[9], BranchingTr.Maximum());
+    for (auto& k : keys) {
+        EXPECT_EQ(k == keys.front() ? nullptr : &entries[k - 1], BranchingTr.Predecessor(&entries[k]));
+        EXPECT_EQ(k == keys.back() ? nullptr : &entries[k + 1], BranchingTr.Successor(&entries[k]));
+    }
+    EXPECT_EQ(nullptr, EmptyTr.Minimum());
+    EXPECT_EQ(nullptr, EmptyTr.Maximum());
+    EXPECT_EQ(nullptr, EmptyTr.Successor(nullptr));
+}
+
+/**
+* Remove & Insert
+*   Unlinks objects without destroying them so they can be linked into another tree.
+*/
+TEST_F(TreeTestIntrusive, Remove) {
+    BranchingTr.Remove(&entries[2]);  // Two children.
+    BranchingTr.Remove(&entries[5]);  // Root.
+    BranchingTr.Remove(&entries[0]);  // Leaf.
+    EXPECT_EQ(nullptr, BranchingTr.Search(2));
+    EXPECT_EQ(std::wstring{ L"2" }, entries[2].item);
+
+    std::vector<Entry*> v = BranchingTr.Walk();
+    std::vector<short> remaining{ 1, 3, 4, 6, 7, 8, 9 };
+    ASSERT_EQ(remaining.size(), v.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        EXPECT_EQ(&entries[remaining[i]], v[i]);
+    }
+
+    EmptyTr.Insert(&entries[5]);
+    EmptyTr.Insert(&entries[2]);
+    EmptyTr.Insert(&entries[0]);
+    EXPECT_EQ(&entries[0], EmptyTr.Minimum());
+    EXPECT_EQ(&entries[2], EmptyTr.Successor(&entries[0]));
+    EXPECT_EQ(&entries[5], EmptyTr.Maximum());
+
+    BranchingTr.Remove(nullptr);
+    EmptyTr.Insert(nullptr);
+}
+
+/**
+* Remove Unlinked
+*   Ignores objects that are not linked into the tree, leaving it intact.
+*/
+TEST_F(TreeTestIntrusive, RemoveUnlinked) {
+    Entry loose{};
+    loose.key = 4;
+    Entry foreign{};
+    foreign.key = 5;
+    EmptyTr.Insert(&foreign);   // Root of another tree.
+
+    EXPECT_FALSE(BranchingTr.IsLinked(&loose));
+    EXPECT_FALSE(BranchingTr.IsLinked(&foreign));
+    EXPECT_TRUE(BranchingTr.IsLinked(&entries[5]));
+    EXPECT_TRUE(BranchingTr.IsLinked(&entries[8]));
+    BranchingTr.Remove(&loose);
+    BranchingTr.Remove(&foreign);
+
+    std::vector<Entry*> v = BranchingTr.Walk();
+    ASSERT_EQ(keys.size(), v.size());
+    for (auto& k : keys) {
+        EXPECT_EQ(&entries[k], v[k]);
+    }
+    EXPECT_EQ(&foreign, EmptyTr.Search(5));
+
+    BranchingTr.Remove(&entries[4]);
+    EXPECT_FALSE(BranchingTr.IsLinked(&entries[4]));
+    BranchingTr.Remove(&entries[4]);    // Already removed.
+    EXPECT_EQ(keys.size() - 1, BranchingTr.Walk().size());
+    EmptyTr.Clear();    // 'foreign' goes out of scope before the fixture.
+}
+
+/**
+* Insert Linked
+*   Ignores objects already linked into this or another tree, leaving both intact.
+*/
+TEST_F(TreeTestIntrusive, InsertLinked) {
+    EmptyTr.Insert(&entries[2]);        // Interior node of another tree.
+    EmptyTr.Insert(&entries[0]);        // Leaf of another tree.
+    BranchingTr.Insert(&entries[5]);    // Own root.
+    BranchingTr.Insert(&entries[8]);    // Own leaf.
+    EXPECT_EQ(nullptr, EmptyTr.Minimum());
+
+    std::vector<Entry*> v = BranchingTr.Walk();
+    ASSERT_EQ(keys.size(), v.size());
+    for (auto& k : keys) {
+        EXPECT_EQ(&entries[k], v[k]);
+        EXPECT_EQ(&entries[k], BranchingTr.Search(k));
+    }
+
+    BranchingTr.Remove(&entries[2]);
+    EmptyTr.Insert(&entries[2]);        // Unlinked again.
+    EXPECT_EQ(&entries[2], EmptyTr.Minimum());
+    EmptyTr.Clear();
+}
+
+/**
+* Clear
+*   Unlinks every object, leaving them reusable.
+*/
+TEST_F(TreeTestIntrusive, Clear) {
+    BranchingTr.Clear();
+    EXPECT_EQ(nullptr, BranchingTr.Minimum());
+    for (auto& k : keys) {
+        EXPECT_EQ(nullptr, BranchingTr.Search(k));
+    }
+    for (auto& k : keys) {
+        EmptyTr.Insert(&entries[keys.size() - 1 - k]);
+    }
+    EXPECT_EQ(keys.size(), EmptyTr.Walk().size());
+    EXPECT_EQ(&entries[0], EmptyTr.Minimum());
+}
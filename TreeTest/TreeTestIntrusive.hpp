@@ -0,0 +1,45 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <string>
+#include "../IntrusiveTree.hpp"
+
+/**
+* class TreeTestIntrusive
+*   Test fixture for the IntrusiveTree interface.
+*/
+class TreeTestIntrusive : public testing::Test {
+protected:
+    struct Entry : TreeHook<Entry> {
+        short key;
+        std::wstring item;
+    };
+
+    void SetUp() override {
+        short Br[10] = { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 };
+        /**
+        * Branching Tree       5
+        *                     / \
+        *                    4   6
+        *                   /     \
+        *                  2       9
+        *                 / \     /
+        *                1   3   7
+        *               /         \
+        *              0           8
+        */
+
+        for (auto& k : keys) {
+            entries[k].key = k;
+            entries[k].item = std::to_wstring(k);
+        }
+        for (auto& k : keys) {
+            BranchingTr.Insert(&entries[Br[k]]);
+        }
+    }
+
+    Entry entries[10];
+    IntrusiveTree<short, Entry> EmptyTr;
+    IntrusiveTree<short, Entry> BranchingTr;
+
+    const std::vector<short>  keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+};
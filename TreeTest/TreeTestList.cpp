@@ -0,0 +1,210 @@
+#include "TreeTestList.hpp"
+
+/**
+* ForwardList
+*   Queue and stack operations over pooled DirectedNode.
+*/
+TEST_F(TreeTestList, ForwardList) {
+    EXPECT_EQ(keys.size(), Forward.Size());
+    EXPECT_EQ(L"0", Forward.Front()->item);
+    EXPECT_EQ(L"9", Forward.Back()->item);
+
+    Forward.PushFront(L"-1");
+    Forward.PopFront();
+    Forward.PopFront();
+    EXPECT_EQ(L"1", Forward.Front()->item);
+    EXPECT_EQ(keys.size() - 1, Forward.Size());
+
+    // Freed slots are reused.
+    auto* freed = Forward.Front();
+    Forward.PopFront();
+    Forward.PushBack(L"10");
+    EXPECT_EQ(freed, Forward.Back());
+
+    Forward.Clear();
+    EXPECT_TRUE(Forward.Empty());
+    EXPECT_EQ(nullptr, Forward.Front());
+    EXPECT_EQ(nullptr, Forward.Back());
+    Forward.PopFront();
+    Forward.PushBack(L"0");
+    EXPECT_EQ(Forward.Front(), Forward.Back());
+}
+
+/**
+* List
+*   Insertion and deletion at either end or around a given node.
+*/
+TEST_F(TreeTestList, List) {
+    Double.PushFront(L"-1");
+    Double.PopBack();
+    Double.Insert(Double.Back(), L"8.5");
+    EXPECT_EQ(L"-1", Double.Front()->item);
+    EXPECT_EQ(L"8", Double.Back()->item);
+    EXPECT_EQ(L"8.5", Double.Back()->prev->item);
+    EXPECT_EQ(L"7", Double.Back()->prev->prev->item);
+
+    auto* n = Double.Front()->next;
+    Double.Delete(&n);
+    EXPECT_EQ(nullptr, n);
+    EXPECT_EQ(L"1", Double.Front()->next->item);
+    EXPECT_EQ(Double.Front(), Double.Front()->next->prev);
+
+    Double.PopFront();
+    EXPECT_EQ(nullptr, Double.Front()->prev);
+    EXPECT_EQ(keys.size() - 1, Double.Size());
+    Double.Delete(nullptr);
+
+    // Walks backward consistently.
+    std::vector<std::wstring> forward = Items(Double);
+    std::vector<std::wstring> backward;
+    for (auto* b = Double.Back(); b; b = b->prev) {
+        backward.insert(backward.begin(), b->item);
+    }
+    EXPECT_EQ(forward, backward);
+}
+
+/**
+* Splice
+*   Relinks nodes between lists sharing a pool and moves items otherwise.
+*/
+TEST_F(TreeTestList, Splice) {
+    ForwardList<std::wstring> shared{ Forward.Share() };
+    shared.PushBack(L"10");
+    auto* node = shared.Front();
+    Forward.Splice(shared);
+    EXPECT_TRUE(shared.Empty());
+    EXPECT_EQ(node, Forward.Back());
+    EXPECT_EQ(keys.size() + 1, Forward.Size());
+
+    ForwardList<std::wstring> separate;
+    separate.PushBack(L"11");
+    Forward.Splice(separate);
+    EXPECT_TRUE(separate.Empty());
+    EXPECT_EQ(L"11", Forward.Back()->item);
+
+    // Into the middle of a doubly linked list.
+    List<std::wstring> middle{ Double.Share() };
+    middle.PushBack(L"a");
+    middle.PushBack(L"b");
+    auto* first = middle.Front();
+    auto* position = Double.Front()->next;
+    Double.Splice(position, middle);
+    EXPECT_TRUE(middle.Empty());
+    EXPECT_EQ(first, Double.Front()->next);
+    EXPECT_EQ(position, Double.Front()->next->next->next);
+    EXPECT_EQ(L"b", position->prev->item);
+    EXPECT_EQ(keys.size() + 2, Double.Size());
+
+    List<std::wstring> back;
+    back.PushBack(L"c");
+    Double.Splice(nullptr, back);
+    EXPECT_EQ(L"c", Double.Back()->item);
+    EXPECT_EQ(L"9", Double.Back()->prev->item);
+}
+
+/**
+* UnrolledList
+*   Packs several items per node while preserving queue order.
+*/
+TEST_F(TreeTestList, UnrolledList) {
+    EXPECT_EQ(keys.size(), Unrolled.Size());
+    EXPECT_EQ(L"0", *Unrolled.Front());
+    EXPECT_EQ(L"9", *Unrolled.Back());
+
+    Unrolled.PushFront(L"-1");
+    Unrolled.PushFront(L"-2");
+    std::vector<std::wstring> v;
+    Unrolled.ForEach([&v](std::wstring& i) { v.push_back(i); });
+    ASSERT_EQ(keys.size() + 2, v.size());
+    EXPECT_EQ(L"-2", v[0]);
+    EXPECT_EQ(L"-1", v[1]);
+    EXPECT_EQ(L"0", v[2]);
+
+    for (int i = 0; i < 7; ++i) {
+        Unrolled.PopFront();
+    }
+    EXPECT_EQ(L"5", *Unrolled.Front());
+    EXPECT_EQ(5u, Unrolled.Size());
+
+    UnrolledList<std::wstring, 4> other{ Unrolled.Share() };
+    other.PushBack(L"10");
+    Unrolled.Splice(other);
+    EXPECT_TRUE(other.Empty());
+    EXPECT_EQ(L"10", *Unrolled.Back());
+    Unrolled.PushBack(L"11");
+    EXPECT_EQ(L"11", *Unrolled.Back());
+
+    while (!Unrolled.Empty()) {
+        Unrolled.PopFront();
+    }
+    EXPECT_EQ(nullptr, Unrolled.Front());
+    EXPECT_EQ(nullptr, Unrolled.Back());
+    Unrolled.PopFront();
+}
+
+/**
+* Clear
+*   Releases nodes in bulk, handing a shared pool the whole chain at once.
+*/
+TEST_F(TreeTestList, Clear) {
+    ForwardList<int> ints;
+    for (int k = 0; k < 200; ++k) {
+        ints.PushBack(static_cast<int&&>(k));
+    }
+    auto* first = ints.Front();
+    ints.Clear();
+    EXPECT_TRUE(ints.Empty());
+    ints.PushBack(0);
+    EXPECT_EQ(first, ints.Front());   // Carving restarts at the first chunk.
+
+    UnrolledList<int> unrolled;
+    for (int k = 0; k < 200; ++k) {
+        unrolled.PushBack(static_cast<int&&>(k));
+    }
+    unrolled.Clear();
+    EXPECT_EQ(nullptr, unrolled.Front());
+
+    ForwardList<int> sharing{ ints.Share() };
+    sharing.PushBack(1);
+    sharing.PushBack(2);
+    auto* head = sharing.Front();
+    sharing.Clear();
+    EXPECT_TRUE(sharing.Empty());
+    EXPECT_EQ(2u, ints.Share().use_count());
+    ints.PushBack(3);
+    EXPECT_EQ(head, ints.Back());     // The chain is reused from its head.
+    EXPECT_EQ(0, ints.Front()->item);
+
+    Double.Clear();
+    Unrolled.Clear();
+    EXPECT_TRUE(Double.Empty());
+    EXPECT_TRUE(Unrolled.Empty());
+}
+
+/**
+* Move
+*   Takes over the nodes and the pool, so the moved-to list may still clear in bulk.
+*/
+TEST_F(TreeTestList, Move) {
+    ForwardList<std::wstring> forward{ std::move(Forward) };
+    List<std::wstring> dbl{ std::move(Double) };
+    UnrolledList<std::wstring, 4> unrolled{ std::move(Unrolled) };
+    EXPECT_EQ(1, forward.Share().use_count());
+    EXPECT_EQ(1, dbl.Share().use_count());
+    EXPECT_EQ(1, unrolled.Share().use_count());
+    EXPECT_EQ(nullptr, Forward.Share());
+    EXPECT_TRUE(Forward.Empty());
+    EXPECT_EQ(keys.size(), forward.Size());
+    EXPECT_EQ(std::wstring{ L"9" }, dbl.Back()->item);
+    EXPECT_EQ(std::wstring{ L"0" }, *unrolled.Front());
+
+    ForwardList<int> ints;
+    for (int k = 0; k < 200; ++k) {
+        ints.PushBack(static_cast<int&&>(k));
+    }
+    auto* first = ints.Front();
+    ForwardList<int> moved{ std::move(ints) };
+    moved.Clear();
+    moved.PushBack(0);
+    EXPECT_EQ(first, moved.Front());    // Bulk clear reset the pool.
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <string>
+#include "../List.hpp"
+
+/**
+* class TreeTestList
+*   Test fixture for the pooled list containers.
+*/
+class TreeTestList : public testing::Test {
+protected:
+    void SetUp() override {
+        for (auto& k : keys) {
+            Forward.PushBack(std::to_wstring(k));
+            Double.PushBack(std::to_wstring(k));
+            Unrolled.PushBack(std::to_wstring(k));
+        }
+    }
+
+    template <class L>
+    static std::vector<std::wstring> Items(const L& l) {
+        std::vector<std::wstring> v;
+        for (auto* n = l.Front(); n; n = n->next) {
+            v.push_back(n->item);
+        }
+        return v;
+    }
+
+    ForwardList<std::wstring> Forward;
+    List<std::wstring> Double;
+    UnrolledList<std::wstring, 4> Unrolled;
+
+    const std::vector<short> keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+};
@@ -0,0 +1,112 @@
+#include "TreeTestPersistent.hpp"
+
+/**
+* Snapshot
+*   Copies share the version they were taken from and are unaffected by later updates.
+*/
+TEST_F(TreeTestPersistent, Snapshot) {
+    PersistentTree<int, int> snapshot{ BranchingTr };
+    EXPECT_EQ(snapshot.Search(5), BranchingTr.Search(5));
+
+    PersistentTree<int, int> updated = BranchingTr.Insert(10, 10).Delete(0);
+    EXPECT_EQ(nullptr, snapshot.Search(10));
+    EXPECT_NE(nullptr, snapshot.Search(0));
+    EXPECT_EQ(10, updated.Search(10)->item);
+    EXPECT_EQ(nullptr, updated.Search(0));
+}
+
+/**
+* Insert
+*   Copies only the path to the new node.
+*/
+TEST_F(TreeTestPersistent, Insert) {
+    PersistentTree<int, int> tr = BranchingTr.Insert(10, 10);
+
+    // Path 5 -> 6 -> 9 is copied; subtrees off the path are shared.
+    EXPECT_NE(BranchingTr.Search(5), tr.Search(5));
+    EXPECT_NE(BranchingTr.Search(6), tr.Search(6));
+    EXPECT_NE(BranchingTr.Search(9), tr.Search(9));
+    EXPECT_EQ(BranchingTr.Search(4), tr.Search(4));
+    EXPECT_EQ(BranchingTr.Search(7), tr.Search(7));
+
+    PersistentTree<int, int> empty = EmptyTr.Insert(10, 10);
+    EXPECT_EQ(nullptr, EmptyTr.Search(10));
+    EXPECT_EQ(10, empty.Search(10)->item);
+}
+
+/**
+* Delete
+*   Removes the key from the new version only.
+*/
+TEST_F(TreeTestPersistent, Delete) {
+    PersistentTree<int, int> tr{ BranchingTr };
+    for (auto& k : keys) {
+        tr = tr.Delete(k);
+        EXPECT_EQ(nullptr, tr.Search(k));
+        EXPECT_EQ(k, BranchingTr.Search(k)->item);
+        if (k != keys.back()) {
+            EXPECT_EQ(k + 1, tr.Minimum()->key);
+        }
+    }
+    EXPECT_EQ(nullptr, tr.Minimum());
+
+    // Two children: 2 is replaced by its successor 3.
+    PersistentTree<int, int> inner = BranchingTr.Delete(2);
+    std::vector<std::pair<int, int>> v = inner.Walk();
+    EXPECT_EQ(9u, v.size());
+    EXPECT_EQ(BranchingTr.Search(1), inner.Search(1));
+
+    // Non-existent values share the whole version.
+    PersistentTree<int, int> same = BranchingTr.Delete(static_cast<int>(keys.size()));
+    EXPECT_EQ(BranchingTr.Search(5), same.Search(5));
+}
+
+/**
+* Minimum, Maximum, Predecessor & Successor
+*   Returns either a valid node pointer to the corresponding value or nullptr.
+*/
+TEST_F(TreeTestPersistent, Order) {
+    EXPECT_EQ(keys.front(), BranchingTr.Minimum()->key);
+    EXPECT_EQ(keys.back(), BranchingTr.Maximum()->key);
+    EXPECT_EQ(nullptr, EmptyTr.Minimum());
+    EXPECT_EQ(nullptr, EmptyTr.Maximum());
+
+    for (auto& k : keys) {
+        const auto* n = BranchingTr.Search(k);
+        const auto* p = BranchingTr.Predecessor(n);
+        const auto* s = BranchingTr.Successor(n);
+        EXPECT_EQ(k == keys.front() ? nullptr : BranchingTr.Search(k - 1), p);
+        EXPECT_EQ(k == keys.back() ? nullptr : BranchingTr.Search(k + 1), s);
+    }
+
+    std::vector<std::pair<int, int>> v = BranchingTr.Walk();
+    for (auto& k : keys) {
+        EXPECT_EQ(k, v[k].first);
+        EXPECT_EQ(k, v[k].second);
+    }
+}
+
+struct Counted {
+    Counted() = default;
+    Counted(const Counted&) { ++copies; }
+    Counted(Counted&&) noexcept {}
+    Counted& operator=(const Counted&) { ++copies; return *this; }
+    Counted& operator=(Counted&&) noexcept { return *this; }
+    static inline int copies{};
+};
+
+/**
+* Path Copy
+*   Each node copied along the modified path copies its item exactly once.
+*/
+TEST_F(TreeTestPersistent, PathCopy) {
+    PersistentTree<int, Counted> t;
+    for (int k : { 5, 4, 6, 9, 7 }) {
+        t = t.Insert(k, Counted{});
+    }
+    Counted::copies = 0;
+    PersistentTree<int, Counted> u = t.Insert(8, Counted{});    // Copies 5, 6, 9 and 7.
+    EXPECT_EQ(4, Counted::copies);
+    EXPECT_NE(nullptr, u.Search(8));
+    EXPECT_EQ(nullptr, t.Search(8));
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <gtest/gtest.h>
+#include "../PersistentTree.hpp"
+
+/**
+* class TreeTestPersistent
+*   Test fixture for the PersistentTree interface.
+*/
+class TreeTestPersistent : public testing::Test {
+protected:
+    void SetUp() override {
+        int Br[10] = { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 };
+        /**
+        * Branching Tree       5
+        *                     / \
+        *                    4   6
+        *                   /     \
+        *                  2       9
+        *                 / \     /
+        *                1   3   7
+        *               /         \
+        *              0           8
+        */
+
+        for (auto& k : keys) {
+            BranchingTr = BranchingTr.Insert(Br[k], static_cast<int&&>(Br[k]));
+        }
+    }
+
+    PersistentTree<int, int> EmptyTr;
+    PersistentTree<int, int> BranchingTr;
+
+    const std::vector<int>  keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+};
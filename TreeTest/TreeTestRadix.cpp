@@ -0,0 +1,141 @@
+#include "TreeTestRadix.hpp"
+#include <map>
+#include <random>
+
+/**
+* Search
+*   Returns either a node pointer to the corresponding value or nullptr.
+*/
+TEST_F(TreeTestRadix, Search) {
+    for (auto& k : keys) {
+        EXPECT_EQ(std::to_wstring(k), IntegerTr.Search(k)->item);
+    }
+    for (auto& w : words) {
+        EXPECT_EQ(static_cast<int>(w.size()), StringTr[w]->item);
+    }
+    EXPECT_EQ(nullptr, IntegerTr.Search(10));
+    EXPECT_EQ(nullptr, IntegerTr.Search(-1));
+    EXPECT_EQ(nullptr, StringTr.Search(L"tre"));
+    EXPECT_EQ(nullptr, StringTr.Search(L"abcd"));
+    EXPECT_EQ(nullptr, EmptyTr.Search(0));
+
+    // Existing keys are replaced.
+    StringTr.Insert(L"ab", 20);
+    EXPECT_EQ(20, StringTr.Search(L"ab")->item);
+    EXPECT_EQ(words.size(), StringTr.Size());
+}
+
+/**
+* Minimum, Maximum, Predecessor & Successor
+*   Follow key order, including negative integers and prefix strings.
+*/
+TEST_F(TreeTestRadix, Order) {
+    IntegerTr.Insert(-300, L"-300");
+    IntegerTr.Insert(300, L"300");
+    std::vector<short> expected{ -300, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 300 };
+    auto* n = IntegerTr.Minimum();
+    for (auto& k : expected) {
+        EXPECT_EQ(k, n->key);
+        n = IntegerTr.Successor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+    n = IntegerTr.Maximum();
+    for (auto it = expected.rbegin(); it != expected.rend(); ++it) {
+        EXPECT_EQ(*it, n->key);
+        n = IntegerTr.Predecessor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+
+    std::vector<std::pair<std::wstring, int>> v = StringTr.Walk();
+    ASSERT_EQ(words.size(), v.size());
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        EXPECT_EQ(words[i], v[i].first);
+    }
+
+    EXPECT_EQ(nullptr, EmptyTr.Minimum());
+    EXPECT_EQ(nullptr, EmptyTr.Maximum());
+    EXPECT_EQ(nullptr, EmptyTr.Successor(nullptr));
+}
+
+/**
+* ForEachInRange
+*   Visits keys in [lo, hi] whether or not the bounds are present.
+*/
+TEST_F(TreeTestRadix, ForEachInRange) {
+    std::vector<std::wstring> visited;
+    auto collect = [&visited](RadixTree<std::wstring, int>::Node* n) { visited.push_back(n->key); return true; };
+    EXPECT_EQ(3u, StringTr.ForEachInRange(L"aa", L"abd", collect));
+    EXPECT_EQ((std::vector<std::wstring>{ L"ab", L"abc", L"abd" }), visited);
+
+    visited.clear();
+    EXPECT_EQ(2u, StringTr.ForEachInRange(L"t", L"treetops", collect));
+    EXPECT_EQ((std::vector<std::wstring>{ L"tree", L"treetop" }), visited);
+
+    std::size_t count{};
+    EXPECT_EQ(2u, IntegerTr.ForEachInRange(3, 8, [&count](auto*) { return ++count < 2; }));
+    EXPECT_EQ(0u, IntegerTr.ForEachInRange(10, 20, [](auto*) { return true; }));
+    EXPECT_EQ(L"abc", StringTr.LowerBound(L"abb")->key);
+    EXPECT_EQ(nullptr, StringTr.LowerBound(L"z"));
+}
+
+/**
+* Delete
+*   Removes the node and collapses emptied paths.
+*/
+TEST_F(TreeTestRadix, Delete) {
+    auto* n = StringTr.Search(L"abc");
+    StringTr.Delete(&n);
+    EXPECT_EQ(nullptr, n);
+    EXPECT_EQ(nullptr, StringTr.Search(L"abc"));
+    EXPECT_EQ(L"abd", StringTr.Successor(StringTr.Search(L"ab"))->key);
+
+    for (auto& w : words) {
+        n = StringTr.Search(w);
+        StringTr.Delete(&n);
+    }
+    EXPECT_EQ(0u, StringTr.Size());
+    EXPECT_EQ(nullptr, StringTr.Minimum());
+
+    StringTr.Delete(nullptr);
+    EmptyTr.Delete(nullptr);
+}
+
+/**
+* Adaptive Nodes
+*   Grow through every node size and shrink back, matching std::map throughout.
+*/
+TEST_F(TreeTestRadix, Adaptive) {
+    RadixTree<int, int> tr;
+    std::map<int, int> reference;
+    std::mt19937 random{ 7 };
+    std::uniform_int_distribution<int> dense{ -2000, 2000 };
+
+    for (int i = 0; i < 6000; ++i) {
+        int k = dense(random);
+        if (random() % 3) {
+            tr.Insert(k, static_cast<int&&>(i));
+            reference[k] = i;
+        }
+        else {
+            auto* n = tr.Search(k);
+            tr.Delete(&n);
+            reference.erase(k);
+        }
+    }
+    ASSERT_EQ(reference.size(), tr.Size());
+    auto* n = tr.Minimum();
+    for (auto& p : reference) {
+        ASSERT_NE(nullptr, n);
+        EXPECT_EQ(p.first, n->key);
+        EXPECT_EQ(p.second, n->item);
+        n = tr.Successor(n);
+    }
+    EXPECT_EQ(nullptr, n);
+
+    for (auto& p : reference) {
+        auto* m = tr.Search(p.first);
+        tr.Delete(&m);
+    }
+    EXPECT_EQ(0u, tr.Size());
+    EXPECT_EQ(nullptr, tr.Minimum());
+}
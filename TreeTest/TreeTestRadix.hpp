@@ -0,0 +1,31 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <string>
+#include "../RadixTree.hpp"
+
+/**
+* class TreeTestRadix
+*   Test fixture for the RadixTree interface over integer and string keys.
+*/
+class TreeTestRadix : public testing::Test {
+protected:
+    void SetUp() override {
+        short Br[10] = { 5, 4, 2, 3, 1, 0, 6, 9, 7, 8 };
+
+        for (auto& k : keys) {
+            IntegerTr.Insert(Br[k], std::to_wstring(Br[k]));
+        }
+        for (auto& w : words) {
+            StringTr.Insert(w, static_cast<int>(w.size()));
+        }
+    }
+
+    RadixTree<short, std::wstring> EmptyTr;
+    RadixTree<short, std::wstring> IntegerTr;
+    RadixTree<std::wstring, int> StringTr;
+
+    const std::vector<short> keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    const std::vector<std::wstring> words{   // Ascending, with shared prefixes.
+        L"", L"a", L"ab", L"abc", L"abd", L"b", L"tree", L"treetop", L"trie"
+    };
+};
@@ -0,0 +1,168 @@
+#include "TreeTestSharded.hpp"
+#include <algorithm>
+#include <random>
+#include <thread>
+
+/**
+* Route
+*   Sends each key to the shard whose range holds it.
+*/
+TEST_F(TreeTestSharded, Route) {
+    EXPECT_EQ(4u, Tr.Shards());
+    EXPECT_EQ(0u, Tr.Route(-5));
+    EXPECT_EQ(0u, Tr.Route(9));
+    EXPECT_EQ(1u, Tr.Route(10));
+    EXPECT_EQ(2u, Tr.Route(29));
+    EXPECT_EQ(3u, Tr.Route(30));
+    EXPECT_EQ(3u, Tr.Route(1000));
+}
+
+/**
+* Search & Delete
+*   Operate on the owning shard only.
+*/
+TEST_F(TreeTestSharded, Search) {
+    for (int k = 0; k < 40; ++k) {
+        EXPECT_EQ(k, Tr.Search(k).value());
+    }
+    EXPECT_FALSE(Tr.Search(40).has_value());
+    EXPECT_FALSE(EmptyTr.Search(0).has_value());
+
+    EXPECT_TRUE(Tr.Delete(15));
+    EXPECT_FALSE(Tr.Delete(15));
+    EXPECT_FALSE(Tr.Search(15).has_value());
+    EXPECT_EQ(39u, Tr.Size());
+    EXPECT_FALSE(EmptyTr.Delete(0));
+}
+
+/**
+* Cursor
+*   Iterates all shards in key order, skipping empty ones.
+*/
+TEST_F(TreeTestSharded, Cursor) {
+    for (int k = 10; k < 20; ++k) {
+        Tr.Delete(k);
+    }
+    std::vector<int> visited;
+    for (auto c = Tr.Begin(); c.node; Tr.Next(c)) {
+        visited.push_back(c.node->key);
+    }
+    ASSERT_EQ(30u, visited.size());
+    EXPECT_TRUE(std::is_sorted(visited.begin(), visited.end()));
+    EXPECT_EQ(9, visited[9]);
+    EXPECT_EQ(20, visited[10]);
+    EXPECT_EQ(nullptr, EmptyTr.Begin().node);
+    EXPECT_EQ(visited.size(), Tr.Walk().size());
+}
+
+/**
+* Rebalance
+*   Evens out shard sizes after the key distribution drifts.
+*/
+TEST_F(TreeTestSharded, Rebalance) {
+    for (int k = 100; k < 140; ++k) {   // All land in the last shard.
+        Tr.Insert(k, static_cast<int&&>(k));
+    }
+    Tr.Insert(100, 100);                // Duplicates move as a group.
+    Tr.Rebalance();
+
+    std::vector<std::size_t> sizes(Tr.Shards());
+    std::vector<std::pair<int, int>> all = Tr.Walk();
+    for (auto& p : all) {
+        ++sizes[Tr.Route(p.first)];
+        EXPECT_EQ(p.second, Tr.Search(p.first).value());
+    }
+    for (auto& s : sizes) {
+        EXPECT_NEAR(81.0 / 4, static_cast<double>(s), 2.0);
+    }
+    EXPECT_EQ(81u, all.size());
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end()));
+    EXPECT_TRUE(Tr.Delete(100));
+    EXPECT_TRUE(Tr.Delete(100));
+    EXPECT_FALSE(Tr.Delete(100));
+
+    EmptyTr.Rebalance();
+    EXPECT_EQ(0u, EmptyTr.Size());
+
+    // Shards are split and joined rather than refilled in key order, so they keep their shape.
+    ShardedTree<int, int> drifted{ { 9, 19, 29 } };
+    std::vector<int> shuffled(4096);
+    for (std::size_t i = 0; i < shuffled.size(); ++i) {
+        shuffled[i] = 100 + static_cast<int>(i);
+    }
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{ 3 });
+    for (int k : shuffled) {
+        drifted.Insert(k, int{ k });
+    }
+    std::size_t height = drifted.Height();
+    drifted.Rebalance();
+    EXPECT_GE(height + drifted.Shards() - 1, drifted.Height());
+    EXPECT_EQ(0u, drifted.Route(1123));
+    EXPECT_EQ(1u, drifted.Route(1124));
+    EXPECT_EQ(shuffled.size(), drifted.Size());
+}
+
+/**
+* Skew
+*   Inserts and deletes even out a pair of neighbouring shards once one side outgrows
+*   the other.
+*/
+TEST_F(TreeTestSharded, Skew) {
+    auto sizes = [this] {
+        std::vector<std::size_t> v(Tr.Shards());
+        for (auto& p : Tr.Walk()) {
+            ++v[Tr.Route(p.first)];
+        }
+        return v;
+    };
+    auto even = [](const std::vector<std::size_t>& v) {
+        for (std::size_t i = 0; i + 1 < v.size(); ++i) {
+            if (4 * (std::min(v[i], v[i + 1]) + 1) < std::max(v[i], v[i + 1])) {
+                return false;
+            }
+        }
+        return true;
+    };
+    for (int k = 100; k < 300; ++k) {   // All route to the last shard at first.
+        Tr.Insert(k, int{ k });
+        ASSERT_TRUE(even(sizes()));
+    }
+    EXPECT_GT(3u, Tr.Route(100));     // Bounds moved up behind the new keys.
+    for (int k = 0; k < 100; ++k) {
+        if (Tr.Search(k)) {
+            Tr.Delete(k);
+            ASSERT_TRUE(even(sizes()));
+        }
+    }
+    std::vector<std::pair<int, int>> all = Tr.Walk();
+    ASSERT_EQ(200u, all.size());
+    for (auto& p : all) {
+        EXPECT_EQ(p.second, Tr.Search(p.first).value());
+    }
+}
+
+/**
+* Concurrency
+*   Writers in disjoint ranges proceed in parallel without losing updates.
+*/
+TEST_F(TreeTestSharded, Concurrency) {
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([this, w] {
+            for (int k = 0; k < 500; ++k) {
+                int key = 1000 * (w + 1) + k;
+                EmptyTr.Insert(key, static_cast<int&&>(key));
+                if (k % 100 == 0) {
+                    EmptyTr.Rebalance();
+                }
+            }
+        });
+    }
+    for (auto& t : writers) {
+        t.join();
+    }
+    EXPECT_EQ(2000u, EmptyTr.Size());
+    for (int w = 1; w <= 4; ++w) {
+        EXPECT_EQ(1000 * w + 499, EmptyTr.Search(1000 * w + 499).value());
+    }
+}
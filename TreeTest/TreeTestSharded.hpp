@@ -0,0 +1,21 @@
+#pragma once
+#include <gtest/gtest.h>
+#include "../ShardedTree.hpp"
+
+/**
+* class TreeTestSharded
+*   Test fixture for the ShardedTree interface.
+*/
+class TreeTestSharded : public testing::Test {
+protected:
+    void SetUp() override {
+        for (int k = 0; k < 40; ++k) {
+            int r = (k * 17) % 40;  // Visits every key in 0..39 out of order.
+            Tr.Insert(r, static_cast<int&&>(r));
+        }
+    }
+
+    // Shards: (.., 9], (9, 19], (19, 29], (29, ..)
+    ShardedTree<int, int> Tr{ { 9, 19, 29 } };
+    ShardedTree<int, int> EmptyTr{ { 0 } };
+};
@@ -0,0 +1,55 @@
+#include "TreeTestStatic.hpp"
+
+/**
+* Compile Time
+*   Lookups on constant keys are evaluated by the compiler.
+*/
+TEST_F(TreeTestStatic, CompileTime) {
+    static_assert(Static::BranchingTr.Search(7)->item == '7', "Search folds.");
+    static_assert(Static::BranchingTr[10] == nullptr, "Missing keys fold.");
+    static_assert(Static::BranchingTr.Minimum()->key == 0, "Minimum folds.");
+    static_assert(Static::BranchingTr.Maximum()->key == 9, "Maximum folds.");
+    static_assert(Static::BranchingTr.Successor(Static::BranchingTr.Search(3))->key == 4, "Successor folds.");
+    static_assert(Static::BranchingTr.Predecessor(Static::BranchingTr.Minimum()) == nullptr, "Predecessor folds.");
+    static_assert(Static::BranchingTr.LowerBound(-1)->key == 0, "LowerBound folds.");
+    static_assert(Static::SingleTr.Search(0)->item == '0', "Single entry.");
+    SUCCEED();
+}
+
+/**
+* Search
+*   Returns either a node pointer to the corresponding value or nullptr.
+*/
+TEST_F(TreeTestStatic, Search) {
+    for (auto& k : keys) {
+        EXPECT_EQ(static_cast<char>('0' + k), BranchingTr.Search(k)->item);
+    }
+    EXPECT_EQ(nullptr, BranchingTr.Search(-1));
+    EXPECT_EQ(nullptr, BranchingTr.Search(10));
+    EXPECT_EQ(nullptr, SingleTr.Search(1));
+    EXPECT_EQ(nullptr, BranchingTr.LowerBound(10));
+}
+
+/**
+* Minimum, Maximum, Predecessor & Successor
+*   Walk every entry in key order.
+*/
+TEST_F(TreeTestStatic, Order) {
+    for (auto& k : keys) {
+        const Table::Node* n = BranchingTr.Search(k);
+        EXPECT_EQ(k == keys.front() ? nullptr : BranchingTr.Search(k - 1), BranchingTr.Predecessor(n));
+        EXPECT_EQ(k == keys.back() ? nullptr : BranchingTr.Search(k + 1), BranchingTr.Successor(n));
+    }
+    EXPECT_EQ(nullptr, SingleTr.Successor(SingleTr.Minimum()));
+    EXPECT_EQ(nullptr, SingleTr.Predecessor(SingleTr.Maximum()));
+    EXPECT_EQ(nullptr, BranchingTr.Successor(nullptr));
+
+    std::vector<std::pair<int, char>> v = BranchingTr.Walk();
+    ASSERT_EQ(keys.size(), v.size());
+    for (auto& k : keys) {
+        EXPECT_EQ(k, v[k].first);
+    }
+
+    // Every size from 1 to 10 is a valid layout.
+    Layouts(std::make_index_sequence<10>{});
+}
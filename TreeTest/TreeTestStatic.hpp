@@ -0,0 +1,67 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <utility>
+#include "../StaticTree.hpp"
+
+namespace Static {
+    using Table = StaticTree<int, char, 10>;
+
+    /**
+    * Entries in the Branching Tree insertion order; the layout does not depend on it.
+    * Kept at namespace scope so that static_assert can read them.
+    */
+    constexpr Table BranchingTr{ {
+        { 5, '5' }, { 4, '4' }, { 2, '2' }, { 3, '3' }, { 1, '1' },
+        { 0, '0' }, { 6, '6' }, { 9, '9' }, { 7, '7' }, { 8, '8' }
+    } };
+    constexpr StaticTree<int, char, 1> SingleTr{ { { 0, '0' } } };
+}
+
+/**
+* class TreeTestStatic
+*   Test fixture for the StaticTree interface.
+*/
+class TreeTestStatic : public testing::Test {
+protected:
+    using Table = Static::Table;
+    const Table& BranchingTr = Static::BranchingTr;
+    const StaticTree<int, char, 1>& SingleTr = Static::SingleTr;
+
+    const std::vector<int>  keys{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    /**
+    * Builds a tree of the keys 1..N, given in descending order, and walks it both ways.
+    */
+    template <std::size_t N>
+    static void Layout() {
+        SCOPED_TRACE(N);
+        typename StaticTree<int, int, N>::Node entries[N]{};
+        for (std::size_t i = 0; i < N; ++i) {
+            entries[i] = { static_cast<int>(N - i), static_cast<int>(N - i) };
+        }
+        const StaticTree<int, int, N> t{ entries };
+        const auto* n = t.Minimum();
+        for (int k = 1; k <= static_cast<int>(N); ++k) {
+            ASSERT_NE(nullptr, n);
+            EXPECT_EQ(k, n->item);
+            EXPECT_EQ(n, t.Search(k));
+            EXPECT_EQ(n, t.LowerBound(k));
+            n = t.Successor(n);
+        }
+        EXPECT_EQ(nullptr, n);
+        n = t.Maximum();
+        for (int k = static_cast<int>(N); k > 0; --k) {
+            ASSERT_NE(nullptr, n);
+            EXPECT_EQ(k, n->key);
+            n = t.Predecessor(n);
+        }
+        EXPECT_EQ(nullptr, n);
+        EXPECT_EQ(nullptr, t.Search(0));
+        EXPECT_EQ(nullptr, t.LowerBound(static_cast<int>(N) + 1));
+    }
+
+    template <std::size_t... N>
+    static void Layouts(std::index_sequence<N...>) {
+        (Layout<N + 1>(), ...);
+    }
+};